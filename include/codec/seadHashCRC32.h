@@ -24,6 +24,22 @@ public:
         return calcStringHashWithContext(context, str.cstr());
     }
 
+    /// Same result as calcStringHash, but can be evaluated at compile time, e.g. for the keys of
+    /// hot lookups:
+    ///     constexpr u32 cHash = HashCRC32::calcStringHashConstexpr("Player");
+    /// It computes the CRC bit by bit, so prefer calcStringHash at runtime.
+    static constexpr u32 calcStringHashConstexpr(const char* str)
+    {
+        u32 hash = -1;
+        while (*str)
+        {
+            hash ^= static_cast<u8>(*str++);
+            for (s32 i = 0; i < 8; ++i)
+                hash = (hash & 1) == 0 ? (hash >> 1) : ((hash >> 1) ^ 0xEDB88320);
+        }
+        return ~hash;
+    }
+
     static void initialize();
 
 private:
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Dynamically sized bit set, for flag sets over many objects (visibility masks, free slot
+/// tracking). Unlike LongBitFlag, the size is chosen at runtime and the storage comes from a
+/// Heap.
+///
+/// The bits are stored in 64-bit words, and the bulk operations (bitwise operations between
+/// arrays, counting, searching) process a word or more at a time. Bits past getBitNum() in the
+/// last word are always zero.
+///
+/// rank and select answer "how many bits are set before this one" and "where is the n-th set
+/// bit" in constant and logarithmic time, using an index of the number of set bits before
+/// every block of 512 bits. The index is not updated automatically: call updateRankIndex after
+/// modifying the array and before using them.
+class BitArray
+{
+public:
+    using Word = u64;
+    static constexpr s32 cBitsPerWord = 64;
+    static constexpr s32 cWordsPerRankBlock = 8;
+
+    BitArray() = default;
+    BitArray(const BitArray&) = delete;
+    BitArray& operator=(const BitArray&) = delete;
+
+    static constexpr s32 calcWordNum(s32 bit_num)
+    {
+        return (bit_num + cBitsPerWord - 1) / cBitsPerWord;
+    }
+
+    static constexpr size_t calculateWorkBufferSize(s32 bit_num)
+    {
+        const s32 word_num = calcWordNum(bit_num);
+        const s32 block_num = (word_num + cWordsPerRankBlock - 1) / cWordsPerRankBlock;
+        return sizeof(Word) * word_num + sizeof(u32) * (block_num + 1);
+    }
+
+    void allocBuffer(s32 bit_num, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 bit_num, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(bit_num) bytes long and 8-byte aligned. All bits
+    /// are reset.
+    void setBuffer(s32 bit_num, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mWords != nullptr; }
+
+    s32 getBitNum() const { return mBitNum; }
+    s32 getWordNum() const { return mWordNum; }
+    Word* getWords() const { return mWords; }
+
+    void setBit(s32 bit) { getWord_(bit) |= makeMask(bit); }
+    void resetBit(s32 bit) { getWord_(bit) &= ~makeMask(bit); }
+    void changeBit(s32 bit, bool on)
+    {
+        if (on)
+            setBit(bit);
+        else
+            resetBit(bit);
+    }
+    void toggleBit(s32 bit) { getWord_(bit) ^= makeMask(bit); }
+    bool isOnBit(s32 bit) const { return (getWord_(bit) & makeMask(bit)) != 0; }
+    bool isOffBit(s32 bit) const { return !isOnBit(bit); }
+    bool testAndClearBit(s32 bit)
+    {
+        Word& word = getWord_(bit);
+        const Word mask = makeMask(bit);
+        const bool was_on = (word & mask) != 0;
+        word &= ~mask;
+        return was_on;
+    }
+
+    void makeAllZero();
+    void makeAllOne();
+    bool isZero() const;
+
+    /// Bitwise operations with an array of the same size, e.g. visible &= in_frustum.
+    void orWith(const BitArray& other);
+    void andWith(const BitArray& other);
+    void andNotWith(const BitArray& other);
+    void xorWith(const BitArray& other);
+
+    /// Popcount.
+    s32 countOnBit() const { return countOnBit(mWords, mWordNum); }
+    /// Popcount of `word_num` words, with SIMD where available.
+    static s32 countOnBit(const Word* words, s32 word_num);
+
+    /// Returns the first set bit at or after `bit`, or -1.
+    s32 findOnBit(s32 bit = 0) const;
+    /// Returns the first reset bit at or after `bit`, or -1. For slot allocators.
+    s32 findOffBit(s32 bit = 0) const;
+
+    // Callable must have the signature s32. The set bits are visited in increasing order, and
+    // the bits that the callable changes may or may not be visited.
+    template <typename Callable>
+    void forEachOnBit(const Callable& callable) const
+    {
+        for (s32 i = 0; i < mWordNum; ++i)
+        {
+            for (Word word = mWords[i]; word != 0; word &= word - 1)
+                callable(i * cBitsPerWord + __builtin_ctzll(word));
+        }
+    }
+
+    /// Rebuilds the index of rank and select.
+    void updateRankIndex();
+    /// Number of set bits in [0, bit).
+    s32 rank(s32 bit) const;
+    /// Position of the set bit with the rank `n` (0 for the first one), or -1 if fewer bits
+    /// are set.
+    s32 select(s32 n) const;
+
+    static Word makeMask(s32 bit) { return Word(1) << (bit % cBitsPerWord); }
+
+private:
+    Word& getWord_(s32 bit) const
+    {
+        SEAD_ASSERT_MSG(u32(bit) < u32(mBitNum), "range over [0,%d) : %d", mBitNum, bit);
+        return mWords[bit / cBitsPerWord];
+    }
+    /// Mask of the bits of the last word that are in the array.
+    Word getLastWordMask_() const;
+
+    Word* mWords = nullptr;
+    /// Number of set bits before every block of cWordsPerRankBlock words, and in total.
+    u32* mRankIndex = nullptr;
+    s32 mBitNum = 0;
+    s32 mWordNum = 0;
+};
+
+}  // namespace sead
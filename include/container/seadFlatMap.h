@@ -0,0 +1,393 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Search and build helpers of FlatMap and FlatSet.
+///
+/// Their keys are stored in Eytzinger order: the order of a breadth-first traversal of a
+/// complete binary search tree, where the children of the key at 1-based position k are at 2k
+/// and 2k + 1. A search reads keys[0] (the root), then keys[1] or keys[2] and so on, so the first
+/// levels share a few cache lines that stay hot, and the descent is a loop without branches
+/// that can prefetch the keys of the next levels. A sorted array with a binary search instead
+/// touches a new cache line at almost every step.
+class FlatTableImpl
+{
+public:
+    /// Returns the 0-based position of the first key not less than `key`, or -1.
+    template <typename Key>
+    static s32 lowerBound(const Key* keys, s32 num, const Key& key)
+    {
+        // The descendants of k that are log2(cPrefetchStride) levels down share a cache line
+        // (assuming 64-byte lines and an aligned buffer), which can be fetched ahead. Small
+        // tables stay in the cache and do not need it.
+        constexpr u32 cPrefetchStride = std::max<u32>(1, 64 / sizeof(Key));
+        constexpr s32 cPrefetchMinNum = 0x4000 / sizeof(Key);
+
+        const u32 n = static_cast<u32>(num);
+        u32 k = 1;
+        if (num >= cPrefetchMinNum)
+        {
+            for (; k * cPrefetchStride <= n; k = 2 * k + static_cast<u32>(keys[k - 1] < key))
+                prefetch_(keys + k * cPrefetchStride - 1);
+        }
+        while (k <= n)
+            k = 2 * k + static_cast<u32>(keys[k - 1] < key);
+        // The last step to the left is the result: strip the steps to the right after it, and
+        // that step itself.
+        k >>= __builtin_ffs(static_cast<s32>(~k));
+        return static_cast<s32>(k) - 1;
+    }
+
+    /// Returns the position of `key`, or -1.
+    template <typename Key>
+    static s32 find(const Key* keys, s32 num, const Key& key)
+    {
+        const s32 i = lowerBound(keys, num, key);
+        return i >= 0 && !(key < keys[i]) ? i : -1;
+    }
+
+    /// Calls `callable` with the positions of the keys in sorted order.
+    template <typename Callable>
+    static void forEachInOrder(s32 num, const Callable& callable)
+    {
+        const u32 n = static_cast<u32>(num);
+        if (n == 0)
+            return;
+
+        // In-order traversal of the implicit tree, with 1-based positions.
+        u32 k = 1;
+        while (2 * k <= n)
+            k *= 2;
+        while (k != 0)
+        {
+            callable(static_cast<s32>(k) - 1);
+            if (2 * k + 1 <= n)
+            {
+                k = 2 * k + 1;
+                while (2 * k <= n)
+                    k *= 2;
+            }
+            else
+            {
+                // Go up while this is a right child, then once more.
+                while (k & 1)
+                    k >>= 1;
+                k >>= 1;
+            }
+        }
+    }
+
+    /// Sorts `keys`, removes the duplicates (keeping the last one added) and moves the keys to
+    /// Eytzinger order, along with the elements of `arrays`: arrays of `num` elements that are
+    /// parallel to `keys`, such as the values of a map. Allocates a work buffer from `work_heap`
+    /// and returns the number of keys kept, or -1 (leaving the arrays unchanged) if the
+    /// allocation failed.
+    template <typename Key, typename... Ts>
+    static s32 build(Key* keys, s32 num, Heap* work_heap, Ts*... arrays)
+    {
+        // The work buffer holds two arrays of indices, followed by room for `num` elements of
+        // the largest type, which is reused for every array.
+        constexpr size_t cAlignment = std::max({sizeof(void*), alignof(Key), alignof(Ts)...});
+        constexpr size_t cElementSize = std::max({sizeof(Key), sizeof(Ts)...});
+        const size_t scratch_offset =
+            (sizeof(s32) * num * 2 + cAlignment - 1) / cAlignment * cAlignment;
+        const size_t work_size = scratch_offset + cElementSize * num;
+        u8* work = new (work_heap, static_cast<s32>(cAlignment), std::nothrow) u8[work_size];
+        if (!work)
+        {
+            SEAD_ASSERT_MSG(false, "failed to allocate the work buffer [%zu]", work_size);
+            return -1;
+        }
+
+        s32* order = reinterpret_cast<s32*>(work);
+        s32* slots = order + num;
+        const s32 kept = sortUnique(order, keys, num);
+        makeEytzingerSlots(slots, kept);
+        relayout_(keys, num, kept, order, slots, work + scratch_offset);
+        (relayout_(arrays, num, kept, order, slots, work + scratch_offset), ...);
+
+        delete[] work;
+        return kept;
+    }
+
+    /// Sorts `order` (indices into `keys`) by key, removes the duplicate keys (keeping the one
+    /// with the largest index, i.e. the last one added) and returns the number of keys kept.
+    template <typename Key>
+    static s32 sortUnique(s32* order, const Key* keys, s32 num)
+    {
+        for (s32 i = 0; i < num; ++i)
+            order[i] = i;
+        std::sort(order, order + num, [keys](s32 a, s32 b) {
+            if (keys[a] < keys[b])
+                return true;
+            if (keys[b] < keys[a])
+                return false;
+            return a < b;
+        });
+
+        s32 kept = 0;
+        for (s32 i = 0; i < num; ++i)
+        {
+            if (i + 1 < num && !(keys[order[i]] < keys[order[i + 1]]))
+                continue;
+            order[kept++] = order[i];
+        }
+        return kept;
+    }
+
+    /// Writes the Eytzinger position of every sorted rank to `slots`.
+    static void makeEytzingerSlots(s32* slots, s32 num)
+    {
+        s32 rank = 0;
+        forEachInOrder(num, [slots, &rank](s32 slot) { slots[rank++] = slot; });
+    }
+
+private:
+    static void prefetch_(const void* ptr)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr);
+#else
+        static_cast<void>(ptr);
+#endif
+    }
+
+    /// Moves the elements at positions order[0..kept) to positions slots[0..kept), going through
+    /// `scratch`, and destroys the others.
+    template <typename T>
+    static void relayout_(T* array, s32 num, s32 kept, const s32* order, const s32* slots,
+                          void* scratch)
+    {
+        T* sorted = static_cast<T*>(scratch);
+        for (s32 i = 0; i < kept; ++i)
+            new (&sorted[i]) T(std::move(array[order[i]]));
+        for (s32 i = 0; i < num; ++i)
+            array[i].~T();
+        for (s32 i = 0; i < kept; ++i)
+        {
+            new (&array[slots[i]]) T(std::move(sorted[i]));
+            sorted[i].~T();
+        }
+    }
+};
+
+/// Sorted associative container for read-mostly tables, stored as two flat arrays (keys and
+/// values) with no per-element overhead.
+///
+/// Elements are added with add and become visible once the table is built: build sorts the keys,
+/// removes duplicates (the last value added for a key wins) and lays the arrays out for
+/// FlatTableImpl searches. It allocates a temporary buffer about the size of the larger of the two
+/// arrays from `work_heap` (or the current heap if it is null), so it is meant to be called at
+/// load time. Lookups require a built table.
+///
+/// Requires Key to have operator< defined.
+template <typename Key, typename Value>
+class FlatMap
+{
+public:
+    FlatMap() = default;
+    FlatMap(const FlatMap&) = delete;
+    FlatMap& operator=(const FlatMap&) = delete;
+
+    static constexpr size_t calcValuesOffset(s32 capacity)
+    {
+        const size_t size = sizeof(Key) * static_cast<size_t>(capacity);
+        return (size + alignof(Value) - 1) / alignof(Value) * alignof(Value);
+    }
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return calcValuesOffset(capacity) + sizeof(Value) * static_cast<size_t>(capacity);
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mKeys != nullptr; }
+
+    bool isEmpty() const { return mSize == 0; }
+    bool isFull() const { return mSize >= mCapacity; }
+    bool isBuilt() const { return mIsBuilt; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+
+    /// Adds an element, which can be looked up after the next call to build.
+    bool add(const Key& key, const Value& value);
+    /// Adds `num` elements and builds the table. Returns false without adding anything if they do
+    /// not fit.
+    bool build(const Key* keys, const Value* values, s32 num, Heap* work_heap = nullptr);
+    bool build(Heap* work_heap = nullptr);
+    void clear();
+
+    Value* find(const Key& key) const
+    {
+        SEAD_ASSERT_MSG(mIsBuilt, "call build() first");
+        const s32 i = FlatTableImpl::find(mKeys, mSize, key);
+        return i >= 0 ? &mValues[i] : nullptr;
+    }
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    // Callable must have the signature const Key&, Value&. The elements are visited in key order.
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        SEAD_ASSERT_MSG(mIsBuilt, "call build() first");
+        FlatTableImpl::forEachInOrder(mSize, [this, &callable](s32 i) {
+            callable(static_cast<const Key&>(mKeys[i]), mValues[i]);
+        });
+    }
+
+private:
+    Key* mKeys = nullptr;
+    Value* mValues = nullptr;
+    s32 mSize = 0;
+    s32 mCapacity = 0;
+    bool mIsBuilt = true;
+};
+
+template <typename Key, typename Value, s32 N>
+class FixedFlatMap : public FlatMap<Key, Value>
+{
+public:
+    FixedFlatMap() { FlatMap<Key, Value>::setBuffer(N, &mWork); }
+    ~FixedFlatMap() { FlatMap<Key, Value>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    std::aligned_storage_t<FlatMap<Key, Value>::calculateWorkBufferSize(N),
+                           std::max(alignof(Key), alignof(Value))>
+        mWork;
+};
+
+template <typename Key, typename Value>
+inline void FlatMap<Key, Value>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename Key, typename Value>
+inline bool FlatMap<Key, Value>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mKeys == nullptr);
+
+    if (capacity < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be larger than zero", capacity);
+        return false;
+    }
+
+    alignment = std::max({alignment, static_cast<s32>(alignof(Key)),
+                          static_cast<s32>(alignof(Value))});
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename Key, typename Value>
+inline void FlatMap<Key, Value>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mKeys = static_cast<Key*>(buffer);
+    mValues = reinterpret_cast<Value*>(static_cast<u8*>(buffer) + calcValuesOffset(capacity));
+    mSize = 0;
+    mCapacity = capacity;
+    mIsBuilt = true;
+}
+
+template <typename Key, typename Value>
+inline void FlatMap<Key, Value>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mKeys);
+    mKeys = nullptr;
+    mValues = nullptr;
+    mCapacity = 0;
+}
+
+template <typename Key, typename Value>
+inline bool FlatMap<Key, Value>::add(const Key& key, const Value& value)
+{
+    if (isFull())
+    {
+        SEAD_ASSERT_MSG(false, "map is full.");
+        return false;
+    }
+
+    new (&mKeys[mSize]) Key(key);
+    new (&mValues[mSize]) Value(value);
+    ++mSize;
+    mIsBuilt = false;
+    return true;
+}
+
+template <typename Key, typename Value>
+inline bool FlatMap<Key, Value>::build(const Key* keys, const Value* values, s32 num,
+                                       Heap* work_heap)
+{
+    if (num > mCapacity - mSize)
+    {
+        SEAD_ASSERT_MSG(false, "map is full [%d + %d > %d]", mSize, num, mCapacity);
+        return false;
+    }
+
+    for (s32 i = 0; i < num; ++i)
+        add(keys[i], values[i]);
+    return build(work_heap);
+}
+
+template <typename Key, typename Value>
+inline bool FlatMap<Key, Value>::build(Heap* work_heap)
+{
+    if (mIsBuilt)
+        return true;
+
+    const s32 kept = FlatTableImpl::build(mKeys, mSize, work_heap, mValues);
+    if (kept < 0)
+        return false;
+
+    mSize = kept;
+    mIsBuilt = true;
+    return true;
+}
+
+template <typename Key, typename Value>
+inline void FlatMap<Key, Value>::clear()
+{
+    for (s32 i = 0; i < mSize; ++i)
+    {
+        mKeys[i].~Key();
+        mValues[i].~Value();
+    }
+    mSize = 0;
+    mIsBuilt = true;
+}
+
+}  // namespace sead
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+#include "container/seadFlatMap.h"
+
+namespace sead
+{
+class Heap;
+
+/// Sorted set for read-mostly tables, stored as a flat array of keys. Same usage as FlatMap:
+/// add the keys, call build, then look them up.
+///
+/// Requires T to have operator< defined.
+template <typename T>
+class FlatSet
+{
+public:
+    FlatSet() = default;
+    FlatSet(const FlatSet&) = delete;
+    FlatSet& operator=(const FlatSet&) = delete;
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return sizeof(T) * static_cast<size_t>(capacity);
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mKeys != nullptr; }
+
+    bool isEmpty() const { return mSize == 0; }
+    bool isFull() const { return mSize >= mCapacity; }
+    bool isBuilt() const { return mIsBuilt; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+
+    /// Adds a key, which can be looked up after the next call to build.
+    bool add(const T& key);
+    /// Adds `num` keys and builds the set. Returns false without adding anything if they do not
+    /// fit.
+    bool build(const T* keys, s32 num, Heap* work_heap = nullptr);
+    bool build(Heap* work_heap = nullptr);
+    void clear();
+
+    const T* find(const T& key) const
+    {
+        SEAD_ASSERT_MSG(mIsBuilt, "call build() first");
+        const s32 i = FlatTableImpl::find(mKeys, mSize, key);
+        return i >= 0 ? &mKeys[i] : nullptr;
+    }
+    bool contains(const T& key) const { return find(key) != nullptr; }
+
+    // Callable must have the signature const T&. The keys are visited in order.
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        SEAD_ASSERT_MSG(mIsBuilt, "call build() first");
+        FlatTableImpl::forEachInOrder(
+            mSize, [this, &callable](s32 i) { callable(static_cast<const T&>(mKeys[i])); });
+    }
+
+private:
+    T* mKeys = nullptr;
+    s32 mSize = 0;
+    s32 mCapacity = 0;
+    bool mIsBuilt = true;
+};
+
+template <typename T, s32 N>
+class FixedFlatSet : public FlatSet<T>
+{
+public:
+    FixedFlatSet() { FlatSet<T>::setBuffer(N, &mWork); }
+    ~FixedFlatSet() { FlatSet<T>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    std::aligned_storage_t<sizeof(T) * N, alignof(T)> mWork;
+};
+
+template <typename T>
+inline void FlatSet<T>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename T>
+inline bool FlatSet<T>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mKeys == nullptr);
+
+    if (capacity < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be larger than zero", capacity);
+        return false;
+    }
+
+    alignment = std::max(alignment, static_cast<s32>(alignof(T)));
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename T>
+inline void FlatSet<T>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mKeys = static_cast<T*>(buffer);
+    mSize = 0;
+    mCapacity = capacity;
+    mIsBuilt = true;
+}
+
+template <typename T>
+inline void FlatSet<T>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mKeys);
+    mKeys = nullptr;
+    mCapacity = 0;
+}
+
+template <typename T>
+inline bool FlatSet<T>::add(const T& key)
+{
+    if (isFull())
+    {
+        SEAD_ASSERT_MSG(false, "set is full.");
+        return false;
+    }
+
+    new (&mKeys[mSize]) T(key);
+    ++mSize;
+    mIsBuilt = false;
+    return true;
+}
+
+template <typename T>
+inline bool FlatSet<T>::build(const T* keys, s32 num, Heap* work_heap)
+{
+    if (num > mCapacity - mSize)
+    {
+        SEAD_ASSERT_MSG(false, "set is full [%d + %d > %d]", mSize, num, mCapacity);
+        return false;
+    }
+
+    for (s32 i = 0; i < num; ++i)
+        add(keys[i]);
+    return build(work_heap);
+}
+
+template <typename T>
+inline bool FlatSet<T>::build(Heap* work_heap)
+{
+    if (mIsBuilt)
+        return true;
+
+    const s32 kept = FlatTableImpl::build(mKeys, mSize, work_heap);
+    if (kept < 0)
+        return false;
+
+    mSize = kept;
+    mIsBuilt = true;
+    return true;
+}
+
+template <typename T>
+inline void FlatSet<T>::clear()
+{
+    for (s32 i = 0; i < mSize; ++i)
+        mKeys[i].~T();
+    mSize = 0;
+    mIsBuilt = true;
+}
+
+}  // namespace sead
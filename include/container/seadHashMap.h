@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Default hash function of HashMap, for integers, enums and pointers. Other key types need a
+/// specialization (or a custom Hash parameter) with the same signature.
+template <typename Key>
+struct HashMapHash
+{
+    static_assert(std::is_integral<Key>() || std::is_enum<Key>() || std::is_pointer<Key>(),
+                  "HashMapHash must be specialized for this key type");
+
+    u32 operator()(const Key& key) const
+    {
+        u64 x;
+        if constexpr (std::is_pointer<Key>())
+            x = static_cast<u64>(reinterpret_cast<uintptr_t>(key));
+        else
+            x = static_cast<u64>(key);
+
+        // Finalizer of MurmurHash3: consecutive keys end up in unrelated buckets.
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return static_cast<u32>(x);
+    }
+};
+
+/// Unordered associative container with a fixed capacity, implemented as an open-addressing hash
+/// table with Robin Hood probing and backward shift deletion.
+///
+/// The elements are stored inline in a single buffer, next to one probe-length byte per bucket,
+/// so a lookup is usually a hash, one byte load and one key comparison; there is no node to
+/// chase. The table has at most 7/8 of its buckets in use. Since the buffer never grows, erase
+/// shifts the following elements back instead of leaving tombstones, and lookups stay fast after
+/// any number of insertions and erasures.
+///
+/// Requires Key to be equality comparable with operator==. Inserting and erasing move elements
+/// and invalidate pointers to values.
+template <typename Key, typename Value, typename Hash = HashMapHash<Key>>
+class HashMap
+{
+public:
+    HashMap() = default;
+    HashMap(const HashMap&) = delete;
+    HashMap& operator=(const HashMap&) = delete;
+
+    /// Number of buckets for `capacity` elements.
+    static constexpr s32 calcBucketNum(s32 capacity)
+    {
+        const s32 min_buckets = capacity + capacity / 7 + 1;
+        s32 num = 8;
+        while (num < min_buckets)
+            num <<= 1;
+        return num;
+    }
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return (sizeof(Slot) + 1) * static_cast<size_t>(calcBucketNum(capacity));
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity) bytes long and aligned for Key and
+    /// Value.
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mSlots != nullptr; }
+
+    bool isEmpty() const { return mSize == 0; }
+    bool isFull() const { return mSize >= mCapacity; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+
+    /// Inserts a new element, or replaces the value of the existing element with the same key.
+    /// Returns nullptr if the map is full.
+    Value* insert(const Key& key, const Value& value);
+    Value* find(const Key& key) const;
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+    /// Returns whether an element was erased.
+    bool erase(const Key& key);
+    void clear();
+
+    // Callable must have the signature const Key&, Value&
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        for (s32 i = 0; i <= mMask; ++i)
+        {
+            if (mDists[i] != 0)
+                callable(static_cast<const Key&>(mSlots[i].key), mSlots[i].value);
+        }
+    }
+
+protected:
+    struct Slot
+    {
+        Key key;
+        Value value;
+    };
+
+    /// Probe lengths are stored in a byte, with 0 for empty buckets.
+    static constexpr u32 cDistMax = 0xff;
+
+    u32 getHomeIndex_(const Key& key) const { return Hash()(key) & static_cast<u32>(mMask); }
+    u32 getNextIndex_(u32 i) const { return (i + 1) & static_cast<u32>(mMask); }
+    u32 getPrevIndex_(u32 i) const { return (i - 1) & static_cast<u32>(mMask); }
+    /// Returns the bucket of `key`, or -1.
+    s32 findIndex_(const Key& key) const;
+    void moveSlot_(u32 dst, u32 src)
+    {
+        new (&mSlots[dst]) Slot(std::move(mSlots[src]));
+        mSlots[src].~Slot();
+    }
+
+    Slot* mSlots = nullptr;
+    /// 1 + the distance of every element to its home bucket, or 0 for empty buckets.
+    u8* mDists = nullptr;
+    s32 mMask = -1;
+    s32 mSize = 0;
+    s32 mCapacity = 0;
+};
+
+template <typename Key, typename Value, s32 N, typename Hash = HashMapHash<Key>>
+class FixedHashMap : public HashMap<Key, Value, Hash>
+{
+public:
+    FixedHashMap() { HashMap<Key, Value, Hash>::setBuffer(N, &mWork); }
+    ~FixedHashMap() { HashMap<Key, Value, Hash>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    using Slot = typename HashMap<Key, Value, Hash>::Slot;
+
+    std::aligned_storage_t<HashMap<Key, Value, Hash>::calculateWorkBufferSize(N), alignof(Slot)>
+        mWork;
+};
+
+template <typename Key, typename Value, typename Hash>
+inline void HashMap<Key, Value, Hash>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename Key, typename Value, typename Hash>
+inline bool HashMap<Key, Value, Hash>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mSlots == nullptr);
+
+    if (capacity < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be larger than zero", capacity);
+        return false;
+    }
+
+    alignment = std::max(alignment, static_cast<s32>(alignof(Slot)));
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline void HashMap<Key, Value, Hash>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    const s32 bucket_num = calcBucketNum(capacity);
+    mSlots = static_cast<Slot*>(buffer);
+    mDists = reinterpret_cast<u8*>(mSlots + bucket_num);
+    mMask = bucket_num - 1;
+    mSize = 0;
+    mCapacity = capacity;
+    for (s32 i = 0; i < bucket_num; ++i)
+        mDists[i] = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline void HashMap<Key, Value, Hash>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mSlots);
+    mSlots = nullptr;
+    mDists = nullptr;
+    mMask = -1;
+    mCapacity = 0;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline s32 HashMap<Key, Value, Hash>::findIndex_(const Key& key) const
+{
+    if (mSize == 0)
+        return -1;
+
+    // An element that is closer to its home bucket than the distance probed so far ends the
+    // search: with Robin Hood probing the key would have taken its place.
+    u32 i = getHomeIndex_(key);
+    for (u32 dist = 1; mDists[i] >= dist; ++dist)
+    {
+        if (mDists[i] == dist && mSlots[i].key == key)
+            return static_cast<s32>(i);
+        i = getNextIndex_(i);
+    }
+    return -1;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline Value* HashMap<Key, Value, Hash>::insert(const Key& key, const Value& value)
+{
+    u32 i = getHomeIndex_(key);
+    u32 dist = 1;
+    for (; mDists[i] >= dist; ++dist)
+    {
+        if (mDists[i] == dist && mSlots[i].key == key)
+        {
+            mSlots[i].value = value;
+            return &mSlots[i].value;
+        }
+        i = getNextIndex_(i);
+    }
+
+    if (isFull())
+    {
+        SEAD_ASSERT_MSG(false, "map is full.");
+        return nullptr;
+    }
+
+    // The new element goes to bucket i, before the elements that are closer to their home
+    // bucket. Shift them forward by one up to the next empty bucket.
+    u32 last = i;
+    while (mDists[last] != 0)
+        last = getNextIndex_(last);
+
+    for (u32 j = last; j != i; j = getPrevIndex_(j))
+    {
+        const u32 prev = getPrevIndex_(j);
+        SEAD_ASSERT_MSG(mDists[prev] < cDistMax, "probe length overflow: bad hash function?");
+        moveSlot_(j, prev);
+        mDists[j] = mDists[prev] + 1;
+    }
+
+    SEAD_ASSERT_MSG(dist <= cDistMax, "probe length overflow: bad hash function?");
+    new (&mSlots[i]) Slot{key, value};
+    mDists[i] = static_cast<u8>(dist);
+    ++mSize;
+    return &mSlots[i].value;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline Value* HashMap<Key, Value, Hash>::find(const Key& key) const
+{
+    const s32 i = findIndex_(key);
+    return i >= 0 ? &mSlots[i].value : nullptr;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline bool HashMap<Key, Value, Hash>::erase(const Key& key)
+{
+    const s32 index = findIndex_(key);
+    if (index < 0)
+        return false;
+
+    // Shift the following elements back by one until one is in its home bucket.
+    u32 i = static_cast<u32>(index);
+    mSlots[i].~Slot();
+    for (u32 next = getNextIndex_(i); mDists[next] > 1; next = getNextIndex_(next))
+    {
+        moveSlot_(i, next);
+        mDists[i] = mDists[next] - 1;
+        i = next;
+    }
+    mDists[i] = 0;
+    --mSize;
+    return true;
+}
+
+template <typename Key, typename Value, typename Hash>
+inline void HashMap<Key, Value, Hash>::clear()
+{
+    for (s32 i = 0; i <= mMask; ++i)
+    {
+        if (mDists[i] != 0)
+        {
+            mSlots[i].~Slot();
+            mDists[i] = 0;
+        }
+    }
+    mSize = 0;
+}
+
+}  // namespace sead
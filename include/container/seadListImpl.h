@@ -2,6 +2,8 @@
 #define SEAD_LIST_IMPL_H_
 
 #include <basis/seadTypes.h>
+#include <prim/seadMemUtil.h>
+#include <prim/seadPtrUtil.h>
 
 namespace sead
 {
@@ -106,6 +108,46 @@ protected:
 
     void clear();
 
+    /// Calls callable(ListNode*) on the first `num_max` nodes in order. While a node is visited,
+    /// the node `Distance` positions ahead and its object (at -obj_offset from the node) are
+    /// prefetched, so that the callable does not wait for the objects it reads. The next node is
+    /// read before the callable runs, so it may erase the node it is given, but no other node.
+    template <s32 Distance, typename Callable>
+    void forEachNodeWithPrefetch_(s32 obj_offset, s32 num_max, const Callable& callable) const
+    {
+        static_assert(Distance > 0, "Distance must be positive");
+
+        ListNode* end = const_cast<ListNode*>(&mStartEnd);
+        ListNode* ahead = mStartEnd.mNext;
+        s32 num_ahead = 0;
+        for (; num_ahead < Distance && num_ahead < num_max && ahead != end; ++num_ahead)
+        {
+            prefetchNode_(ahead, obj_offset);
+            ahead = ahead->mNext;
+        }
+
+        ListNode* node = mStartEnd.mNext;
+        for (s32 num = 0; num < num_max && node != end; ++num)
+        {
+            ListNode* next = node->mNext;
+            if (num_ahead < num_max && ahead != end)
+            {
+                prefetchNode_(ahead, obj_offset);
+                ahead = ahead->mNext;
+                ++num_ahead;
+            }
+            callable(node);
+            node = next;
+        }
+    }
+
+    static void prefetchNode_(const ListNode* node, s32 obj_offset)
+    {
+        MemUtil::prefetch(node);
+        if (obj_offset != 0)
+            MemUtil::prefetch(PtrUtil::addOffset(node, -obj_offset));
+    }
+
     // FIXME: this should take an rvalue reference for predicate.
     template <class T, class ComparePredicate>
     static void mergeSortImpl_(ListNode* front, ListNode* back, s32 num, s32 offset,
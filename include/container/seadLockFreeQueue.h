@@ -0,0 +1,544 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+#include "thread/seadAtomic.h"
+
+namespace sead
+{
+class Heap;
+
+/// Bounded queues for passing objects between threads without a lock.
+///
+/// Atomic only provides relaxed operations, so ordering comes from fences: a slot is published
+/// with a release fence before the index or sequence store, and read after an acquire fence
+/// that follows the load. The indices that different threads write are on separate cache lines
+/// so that a producer and a consumer do not invalidate each other's line on every operation.
+///
+/// The capacity is rounded up to a power of two. Indices are free-running u32 values that wrap
+/// around, which is fine as long as the capacity is below 2^31.
+class LockFreeQueueBase
+{
+public:
+    static constexpr s32 cCacheLineSize = 64;
+
+    static constexpr s32 calcBufferCapacity(s32 capacity)
+    {
+        s32 num = 1;
+        while (num < capacity)
+            num <<= 1;
+        return num;
+    }
+
+protected:
+    static void acquireFence_() { std::atomic_thread_fence(std::memory_order_acquire); }
+    static void releaseFence_() { std::atomic_thread_fence(std::memory_order_release); }
+};
+
+/// Single producer, single consumer queue: push must only be called from one thread at a time,
+/// and pop from one thread at a time. An operation is a few loads and one store, with no
+/// read-modify-write; each side caches the last index it read from the other side and only
+/// reloads it when the queue looks full (or empty).
+template <typename T>
+class SpscQueue : public LockFreeQueueBase
+{
+public:
+    SpscQueue() = default;
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return sizeof(T) * static_cast<size_t>(calcBufferCapacity(capacity));
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity) bytes long and aligned for T.
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mBuffer != nullptr; }
+
+    s32 capacity() const { return static_cast<s32>(mMask + 1); }
+    /// Only exact when called by the producer or the consumer while the other side is idle.
+    s32 size() const { return static_cast<s32>(mTail.load() - mHead.load()); }
+    bool isEmpty() const { return size() == 0; }
+
+    /// Producer side. Returns false if the queue is full.
+    bool push(const T& value) { return emplace_(value); }
+    bool push(T&& value) { return emplace_(std::move(value)); }
+    /// Producer side. Pushes as many of the `num` values as fit and returns their number.
+    s32 pushBatch(const T* values, s32 num);
+
+    /// Consumer side. Returns false if the queue is empty.
+    bool pop(T* out);
+    /// Consumer side. Pops up to `num` values and returns their number.
+    s32 popBatch(T* out, s32 num);
+
+    /// Destroys the queued values. Neither side may use the queue at the same time.
+    void clear();
+
+private:
+    template <typename U>
+    bool emplace_(U&& value);
+    /// Number of free slots, as seen by the producer.
+    u32 calcFreeNum_(u32 tail, u32 wanted);
+    /// Number of queued values, as seen by the consumer.
+    u32 calcQueuedNum_(u32 head, u32 wanted);
+
+    // Written by the consumer.
+    alignas(cCacheLineSize) Atomic<u32> mHead = 0;
+    u32 mCachedTail = 0;
+    // Written by the producer.
+    alignas(cCacheLineSize) Atomic<u32> mTail = 0;
+    u32 mCachedHead = 0;
+    // Read only.
+    alignas(cCacheLineSize) T* mBuffer = nullptr;
+    u32 mMask = static_cast<u32>(-1);
+};
+
+/// Multiple producer, multiple consumer queue (Dmitry Vyukov's bounded queue). Every slot has
+/// a sequence number that tells whether it is ready for the producer or for the consumer of a
+/// given turn: a thread claims a slot with one compare-exchange on the shared index, then
+/// publishes it with a store to the sequence of the slot. There is no lock, but a thread that
+/// is suspended between claiming and publishing a slot stalls the threads that wait for that
+/// slot.
+///
+/// Batch operations claim all the ready slots in one compare-exchange.
+template <typename T>
+class MpmcQueue : public LockFreeQueueBase
+{
+public:
+    MpmcQueue() = default;
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return sizeof(Cell) * static_cast<size_t>(calcBufferCapacity(capacity));
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity) bytes long and aligned for T and u32.
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mCells != nullptr; }
+
+    s32 capacity() const { return static_cast<s32>(mMask + 1); }
+    /// Approximate when other threads use the queue.
+    s32 size() const
+    {
+        const s32 size = static_cast<s32>(mPushPos.load() - mPopPos.load());
+        return std::clamp(size, 0, capacity());
+    }
+    bool isEmpty() const { return size() == 0; }
+
+    /// Returns false if the queue is full.
+    bool push(const T& value) { return emplace_(value); }
+    bool push(T&& value) { return emplace_(std::move(value)); }
+    /// Pushes as many of the `num` values as fit and returns their number.
+    s32 pushBatch(const T* values, s32 num);
+
+    /// Returns false if the queue is empty.
+    bool pop(T* out);
+    /// Pops up to `num` values and returns their number.
+    s32 popBatch(T* out, s32 num);
+
+    /// Destroys the queued values. No other thread may use the queue at the same time.
+    void clear();
+
+protected:
+    struct Cell
+    {
+        Atomic<u32> sequence;
+        std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+        T* getValue() { return reinterpret_cast<T*>(&storage); }
+    };
+
+private:
+    template <typename U>
+    bool emplace_(U&& value);
+    /// Claims up to `num` consecutive slots from the index `pos`, where the slot at position p is
+    /// ready if its sequence is p + turn. Returns the first claimed position and sets `num` to
+    /// the number of claimed slots.
+    u32 claim_(Atomic<u32>* pos, u32 turn, s32* num);
+
+    alignas(cCacheLineSize) Atomic<u32> mPushPos = 0;
+    alignas(cCacheLineSize) Atomic<u32> mPopPos = 0;
+    alignas(cCacheLineSize) Cell* mCells = nullptr;
+    u32 mMask = static_cast<u32>(-1);
+};
+
+template <typename T, s32 N>
+class FixedSpscQueue : public SpscQueue<T>
+{
+public:
+    FixedSpscQueue() { SpscQueue<T>::setBuffer(N, &mWork); }
+    ~FixedSpscQueue() { SpscQueue<T>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    std::aligned_storage_t<SpscQueue<T>::calculateWorkBufferSize(N), alignof(T)> mWork;
+};
+
+template <typename T, s32 N>
+class FixedMpmcQueue : public MpmcQueue<T>
+{
+public:
+    FixedMpmcQueue() { MpmcQueue<T>::setBuffer(N, &mWork); }
+    ~FixedMpmcQueue() { MpmcQueue<T>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    using Cell = typename MpmcQueue<T>::Cell;
+
+    std::aligned_storage_t<MpmcQueue<T>::calculateWorkBufferSize(N), alignof(Cell)> mWork;
+};
+
+template <typename T>
+inline void SpscQueue<T>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename T>
+inline bool SpscQueue<T>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mBuffer == nullptr);
+
+    if (capacity < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be larger than zero", capacity);
+        return false;
+    }
+
+    alignment = std::max(alignment, static_cast<s32>(alignof(T)));
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename T>
+inline void SpscQueue<T>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mBuffer = static_cast<T*>(buffer);
+    mMask = static_cast<u32>(calcBufferCapacity(capacity) - 1);
+    mHead.store(0);
+    mTail.store(0);
+    mCachedHead = 0;
+    mCachedTail = 0;
+}
+
+template <typename T>
+inline void SpscQueue<T>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mBuffer);
+    mBuffer = nullptr;
+    mMask = static_cast<u32>(-1);
+}
+
+template <typename T>
+inline u32 SpscQueue<T>::calcFreeNum_(u32 tail, u32 wanted)
+{
+    u32 free_num = mMask + 1 - (tail - mCachedHead);
+    if (free_num < wanted)
+    {
+        mCachedHead = mHead.load();
+        // The consumer has moved the values out of the slots before it released them.
+        acquireFence_();
+        free_num = mMask + 1 - (tail - mCachedHead);
+    }
+    return free_num;
+}
+
+template <typename T>
+inline u32 SpscQueue<T>::calcQueuedNum_(u32 head, u32 wanted)
+{
+    u32 queued_num = mCachedTail - head;
+    if (queued_num < wanted)
+    {
+        mCachedTail = mTail.load();
+        acquireFence_();
+        queued_num = mCachedTail - head;
+    }
+    return queued_num;
+}
+
+template <typename T>
+template <typename U>
+inline bool SpscQueue<T>::emplace_(U&& value)
+{
+    const u32 tail = mTail.load();
+    if (calcFreeNum_(tail, 1) == 0)
+        return false;
+
+    new (&mBuffer[tail & mMask]) T(std::forward<U>(value));
+    releaseFence_();
+    mTail.store(tail + 1);
+    return true;
+}
+
+template <typename T>
+inline s32 SpscQueue<T>::pushBatch(const T* values, s32 num)
+{
+    const u32 tail = mTail.load();
+    const u32 count = std::min(calcFreeNum_(tail, static_cast<u32>(num)), static_cast<u32>(num));
+    if (count == 0)
+        return 0;
+
+    for (u32 i = 0; i < count; ++i)
+        new (&mBuffer[(tail + i) & mMask]) T(values[i]);
+    releaseFence_();
+    mTail.store(tail + count);
+    return static_cast<s32>(count);
+}
+
+template <typename T>
+inline bool SpscQueue<T>::pop(T* out)
+{
+    const u32 head = mHead.load();
+    if (calcQueuedNum_(head, 1) == 0)
+        return false;
+
+    T& value = mBuffer[head & mMask];
+    *out = std::move(value);
+    value.~T();
+    releaseFence_();
+    mHead.store(head + 1);
+    return true;
+}
+
+template <typename T>
+inline s32 SpscQueue<T>::popBatch(T* out, s32 num)
+{
+    const u32 head = mHead.load();
+    const u32 count = std::min(calcQueuedNum_(head, static_cast<u32>(num)), static_cast<u32>(num));
+    if (count == 0)
+        return 0;
+
+    for (u32 i = 0; i < count; ++i)
+    {
+        T& value = mBuffer[(head + i) & mMask];
+        out[i] = std::move(value);
+        value.~T();
+    }
+    releaseFence_();
+    mHead.store(head + count);
+    return static_cast<s32>(count);
+}
+
+template <typename T>
+inline void SpscQueue<T>::clear()
+{
+    if (!isBufferReady())
+        return;
+
+    const u32 tail = mTail.load();
+    for (u32 i = mHead.load(); i != tail; ++i)
+        mBuffer[i & mMask].~T();
+    mHead.store(tail);
+    mCachedHead = tail;
+    mCachedTail = tail;
+}
+
+template <typename T>
+inline void MpmcQueue<T>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename T>
+inline bool MpmcQueue<T>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mCells == nullptr);
+
+    if (capacity < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be larger than zero", capacity);
+        return false;
+    }
+
+    alignment = std::max(alignment, static_cast<s32>(alignof(Cell)));
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename T>
+inline void MpmcQueue<T>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    const s32 num = calcBufferCapacity(capacity);
+    mCells = static_cast<Cell*>(buffer);
+    mMask = static_cast<u32>(num - 1);
+    for (s32 i = 0; i < num; ++i)
+        new (&mCells[i].sequence) Atomic<u32>(static_cast<u32>(i));
+    mPushPos.store(0);
+    mPopPos.store(0);
+}
+
+template <typename T>
+inline void MpmcQueue<T>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mCells);
+    mCells = nullptr;
+    mMask = static_cast<u32>(-1);
+}
+
+template <typename T>
+inline u32 MpmcQueue<T>::claim_(Atomic<u32>* pos_atomic, u32 turn, s32* num)
+{
+    u32 pos = pos_atomic->load();
+    while (true)
+    {
+        // The slot pos + i is ready if its sequence is pos + i + turn. A smaller sequence means
+        // that the slot is still used by the previous turn (the queue is full or empty), and a
+        // larger one that another thread has claimed it after we read pos.
+        s32 count = 0;
+        s32 diff = 0;
+        for (; count < *num; ++count)
+        {
+            const u32 slot_pos = pos + static_cast<u32>(count);
+            const u32 sequence = mCells[slot_pos & mMask].sequence.load();
+            diff = static_cast<s32>(sequence - (slot_pos + turn));
+            if (diff != 0)
+                break;
+        }
+
+        if (count == 0 && diff > 0)
+        {
+            pos = pos_atomic->load();
+            continue;
+        }
+        if (count == 0 || pos_atomic->compareExchange(pos, pos + static_cast<u32>(count), &pos))
+        {
+            *num = count;
+            // Pairs with the release fence of the thread that published the slots.
+            acquireFence_();
+            return pos;
+        }
+    }
+}
+
+template <typename T>
+template <typename U>
+inline bool MpmcQueue<T>::emplace_(U&& value)
+{
+    s32 num = 1;
+    const u32 pos = claim_(&mPushPos, 0, &num);
+    if (num == 0)
+        return false;
+
+    Cell& cell = mCells[pos & mMask];
+    new (cell.getValue()) T(std::forward<U>(value));
+    releaseFence_();
+    cell.sequence.store(pos + 1);
+    return true;
+}
+
+template <typename T>
+inline s32 MpmcQueue<T>::pushBatch(const T* values, s32 num)
+{
+    const u32 pos = claim_(&mPushPos, 0, &num);
+    for (s32 i = 0; i < num; ++i)
+        new (mCells[(pos + i) & mMask].getValue()) T(values[i]);
+    releaseFence_();
+    for (s32 i = 0; i < num; ++i)
+        mCells[(pos + i) & mMask].sequence.store(pos + i + 1);
+    return num;
+}
+
+template <typename T>
+inline bool MpmcQueue<T>::pop(T* out)
+{
+    s32 num = 1;
+    const u32 pos = claim_(&mPopPos, 1, &num);
+    if (num == 0)
+        return false;
+
+    Cell& cell = mCells[pos & mMask];
+    *out = std::move(*cell.getValue());
+    cell.getValue()->~T();
+    releaseFence_();
+    // The slot is ready for the push of the next turn.
+    cell.sequence.store(pos + mMask + 1);
+    return true;
+}
+
+template <typename T>
+inline s32 MpmcQueue<T>::popBatch(T* out, s32 num)
+{
+    const u32 pos = claim_(&mPopPos, 1, &num);
+    for (s32 i = 0; i < num; ++i)
+    {
+        T* value = mCells[(pos + i) & mMask].getValue();
+        out[i] = std::move(*value);
+        value->~T();
+    }
+    releaseFence_();
+    for (s32 i = 0; i < num; ++i)
+        mCells[(pos + i) & mMask].sequence.store(pos + i + mMask + 1);
+    return num;
+}
+
+template <typename T>
+inline void MpmcQueue<T>::clear()
+{
+    if (!isBufferReady())
+        return;
+
+    const u32 push_pos = mPushPos.load();
+    for (u32 pos = mPopPos.load(); pos != push_pos; ++pos)
+    {
+        Cell& cell = mCells[pos & mMask];
+        cell.getValue()->~T();
+        cell.sequence.store(pos + mMask + 1);
+    }
+    mPopPos.store(push_pos);
+}
+
+}  // namespace sead
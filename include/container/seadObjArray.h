@@ -139,8 +139,27 @@ public:
 
     void sort() { sort(compareT); }
     void sort(CompareCallback cmp) { PtrArrayImpl::sort<T>(cmp); }
+    /// Compare must have the same signature as CompareCallback. Unlike with a function pointer,
+    /// the comparisons can be inlined.
+    template <typename Compare>
+    void sort(const Compare& cmp)
+    {
+        PtrArrayImpl::sort_<T>(cmp);
+    }
     void heapSort() { heapSort(compareT); }
     void heapSort(CompareCallback cmp) { PtrArrayImpl::heapSort_<T>(cmp); }
+    template <typename Compare>
+    void heapSort(const Compare& cmp)
+    {
+        PtrArrayImpl::heapSort_<T, const Compare&>(cmp);
+    }
+    /// Stable sort by an integer or floating point key; see RadixSort. KeyFunc must have the
+    /// signature Key (const T*).
+    template <typename KeyFunc>
+    bool radixSort(const KeyFunc& key, Heap* work_heap = nullptr)
+    {
+        return RadixSort::sort(data(), mPtrNum, key, work_heap);
+    }
 
     bool equal(const ObjArray& other, CompareCallback cmp) const
     {
@@ -4,6 +4,7 @@
 #include <basis/seadRawPrint.h>
 #include <basis/seadTypes.h>
 #include <container/seadListImpl.h>
+#include <container/seadPtrArray.h>
 #include <prim/seadPtrUtil.h>
 
 namespace sead
@@ -171,6 +172,39 @@ public:
     };
     RobustRange robustRange() const { return {*this}; }
 
+    /// Calls callable(T*) on every element in order, prefetching the elements PrefetchDistance
+    /// positions ahead. Faster than the iterators on long lists whose elements are not in the
+    /// cache. The callable may erase the element it is given, but no other element.
+    template <s32 PrefetchDistance = 4, typename Callable>
+    void forEachWithPrefetch(const Callable& callable) const
+    {
+        ListImpl::forEachNodeWithPrefetch_<PrefetchDistance>(
+            mOffset, mCount, [this, &callable](ListNode* node) { callable(listNodeToObj(node)); });
+    }
+
+    /// Copies pointers to the first `num_max` elements to `dst`, in order, and returns how many
+    /// were copied. Traversing the snapshot does not chase a pointer per element, which makes
+    /// repeated traversals of an unchanged list faster.
+    s32 copyTo(T** dst, s32 num_max) const
+    {
+        s32 num = 0;
+        ListImpl::forEachNodeWithPrefetch_<4>(mOffset, num_max, [this, dst, &num](ListNode* node) {
+            dst[num++] = listNodeToObj(node);
+        });
+        return num;
+    }
+
+    /// Appends pointers to the elements to `array`, as many as it has room for. Returns whether
+    /// all elements were copied.
+    bool copyTo(PtrArray<T>* array) const
+    {
+        const s32 num = array->size();
+        ListImpl::forEachNodeWithPrefetch_<4>(
+            mOffset, array->capacity() - num,
+            [this, array](ListNode* node) { array->pushBack(listNodeToObj(node)); });
+        return array->size() - num == size();
+    }
+
 protected:
     static int compareT(const T* lhs, const T* rhs)
     {
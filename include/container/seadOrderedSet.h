@@ -70,11 +70,23 @@ public:
     void clear();
 
     Node* find(const Value& value) const;
+    Node* lowerBound(const Value& value) const
+    {
+        return static_cast<Node*>(MapImpl::lowerBound(value));
+    }
+    Node* upperBound(const Value& value) const
+    {
+        return static_cast<Node*>(MapImpl::upperBound(value));
+    }
 
     // Callable must have the signature Value&
     template <typename Callable>
     void forEach(const Callable& delegate) const;
 
+    using iterator = typename MapImpl::template NodeIterator<Node>;
+    iterator begin() const { return iterator(this, startIterating()); }
+    iterator end() const { return iterator(this, nullptr); }
+
     Node* startIterating() const { return static_cast<Node*>(MapImpl::startIterating()); }
     Node* nextNode(Node* node) const { return static_cast<Node*>(MapImpl::nextNode(node)); }
 
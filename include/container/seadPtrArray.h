@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <basis/seadRawPrint.h>
 #include <basis/seadTypes.h>
+#include <container/seadRadixSort.h>
 #include <prim/seadMemUtil.h>
 #include <random/seadRandom.h>
 
@@ -173,6 +174,15 @@ protected:
 
     void sort(CompareCallbackImpl cmp);
 
+    /// Same as sort, but `cmp` is called directly and can be inlined.
+    template <typename T, typename Compare>
+    void sort_(const Compare& cmp)
+    {
+        std::sort(mPtrs, mPtrs + size(), [&](const void* a, const void* b) {
+            return cmp(static_cast<const T*>(a), static_cast<const T*>(b)) < 0;
+        });
+    }
+
     template <typename T, typename Compare>
     void heapSort_(Compare cmp)
     {
@@ -255,8 +265,42 @@ public:
 
     void sort() { sort(compareT); }
     void sort(CompareCallback cmp) { PtrArrayImpl::sort<T>(cmp); }
+    /// Compare must have the same signature as CompareCallback. Unlike with a function pointer,
+    /// the comparisons can be inlined.
+    template <typename Compare>
+    void sort(const Compare& cmp)
+    {
+        PtrArrayImpl::sort_<T>(cmp);
+    }
     void heapSort() { heapSort(compareT); }
     void heapSort(CompareCallback cmp) { PtrArrayImpl::heapSort_<T>(cmp); }
+    template <typename Compare>
+    void heapSort(const Compare& cmp)
+    {
+        PtrArrayImpl::heapSort_<T, const Compare&>(cmp);
+    }
+    /// Stable sort by an integer or floating point key; see RadixSort. KeyFunc must have the
+    /// signature Key (const T*).
+    template <typename KeyFunc>
+    bool radixSort(const KeyFunc& key, Heap* work_heap = nullptr)
+    {
+        return RadixSort::sort(data(), mPtrNum, key, work_heap);
+    }
+
+    /// Calls callable(T*) on every element in order, prefetching the element PrefetchDistance
+    /// positions ahead. For arrays of pointers to objects that are not in the cache, such as
+    /// snapshots of lists (see OffsetList::copyTo).
+    template <s32 PrefetchDistance = 8, typename Callable>
+    void forEachWithPrefetch(const Callable& callable) const
+    {
+        T** ptrs = data();
+        for (s32 i = 0; i < mPtrNum; ++i)
+        {
+            if (i + PrefetchDistance < mPtrNum)
+                MemUtil::prefetch(ptrs[i + PrefetchDistance]);
+            callable(ptrs[i]);
+        }
+    }
 
     bool equal(const PtrArray& other, CompareCallback cmp) const
     {
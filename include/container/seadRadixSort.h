@@ -0,0 +1,136 @@
+#pragma once
+
+#include <new>
+#include <type_traits>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+#include "prim/seadBitUtil.h"
+
+namespace sead
+{
+class Heap;
+
+/// Stable LSD radix sort of pointer arrays by an integer or floating point key, for large arrays
+/// where comparison sorts are too slow (e.g. draw lists sorted by depth or material ID).
+///
+/// The keys are extracted once per element and converted to unsigned integers with the same
+/// order, then sorted by 8-bit digits: one pass per byte of the key, skipping the bytes that
+/// are equal in all keys. The sort needs a work buffer of 2 * (key size + pointer size) bytes
+/// per element, which is allocated from `work_heap` (or the current heap if it is null).
+class RadixSort
+{
+public:
+    /// Unsigned integer with the same order as Key.
+    template <typename Key>
+    using SortableKey = std::conditional_t<(sizeof(Key) > 4), u64, u32>;
+
+    template <typename Key>
+    static SortableKey<Key> toSortableKey(Key key)
+    {
+        static_assert(std::is_arithmetic<Key>() || std::is_enum<Key>(),
+                      "keys must be integers, enums or floating point numbers");
+        static_assert(sizeof(Key) <= 8, "keys must be at most 64-bit");
+
+        using UKey = SortableKey<Key>;
+        constexpr UKey cSignBit = UKey(1) << (sizeof(UKey) * 8 - 1);
+
+        if constexpr (std::is_enum<Key>())
+        {
+            return toSortableKey(static_cast<std::underlying_type_t<Key>>(key));
+        }
+        else if constexpr (std::is_floating_point<Key>())
+        {
+            // Negative numbers have all their bits flipped so that larger magnitudes sort first;
+            // positive numbers only have their sign bit set.
+            using Bits = std::conditional_t<sizeof(Key) == 4, u32, u64>;
+            const UKey bits = BitUtil::bitCast<Bits>(key);
+            return bits ^ ((bits & cSignBit) ? ~UKey(0) : cSignBit);
+        }
+        else if constexpr (std::is_signed<Key>())
+        {
+            // Sign extend, then move the negative numbers below the positive ones.
+            return static_cast<UKey>(static_cast<std::make_signed_t<UKey>>(key)) ^ cSignBit;
+        }
+        else
+        {
+            return static_cast<UKey>(key);
+        }
+    }
+
+    /// Sorts `ptrs` by `key(ptrs[i])` in ascending order. Elements with equal keys keep their
+    /// relative order. KeyFunc must have the signature Key (const T*). Returns false if the work
+    /// buffer could not be allocated.
+    template <typename T, typename KeyFunc>
+    static bool sort(T** ptrs, s32 num, const KeyFunc& key, Heap* work_heap = nullptr);
+};
+
+template <typename T, typename KeyFunc>
+inline bool RadixSort::sort(T** ptrs, s32 num, const KeyFunc& key, Heap* work_heap)
+{
+    using Key = std::decay_t<decltype(key(static_cast<const T*>(nullptr)))>;
+    using UKey = SortableKey<Key>;
+    constexpr s32 cDigitNum = sizeof(UKey);
+
+    struct Item
+    {
+        UKey key;
+        T* ptr;
+    };
+
+    if (num < 2)
+        return true;
+
+    Item* items = new (work_heap, alignof(Item), std::nothrow) Item[num * 2];
+    if (!items)
+    {
+        SEAD_ASSERT_MSG(false, "failed to allocate the work buffer [%zu]", sizeof(Item) * num * 2);
+        return false;
+    }
+
+    // Extract the keys and count the digits of all the passes at once.
+    u32 counts[cDigitNum][256] = {};
+    for (s32 i = 0; i < num; ++i)
+    {
+        const UKey k = toSortableKey(key(static_cast<const T*>(ptrs[i])));
+        items[i].key = k;
+        items[i].ptr = ptrs[i];
+        for (s32 digit = 0; digit < cDigitNum; ++digit)
+            ++counts[digit][(k >> (digit * 8)) & 0xff];
+    }
+
+    Item* src = items;
+    Item* dst = items + num;
+    for (s32 digit = 0; digit < cDigitNum; ++digit)
+    {
+        u32* count = counts[digit];
+        const u32 first_digit = (src[0].key >> (digit * 8)) & 0xff;
+        if (count[first_digit] == u32(num))
+            continue;
+
+        // Counts to offsets.
+        u32 offset = 0;
+        for (s32 i = 0; i < 256; ++i)
+        {
+            const u32 c = count[i];
+            count[i] = offset;
+            offset += c;
+        }
+
+        for (s32 i = 0; i < num; ++i)
+            dst[count[(src[i].key >> (digit * 8)) & 0xff]++] = src[i];
+
+        Item* tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    for (s32 i = 0; i < num; ++i)
+        ptrs[i] = src[i].ptr;
+
+    delete[] items;
+    return true;
+}
+
+}  // namespace sead
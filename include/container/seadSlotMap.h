@@ -0,0 +1,308 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Stable reference to an element of a SlotMap: the index of a slot and the generation of the
+/// slot when the element was inserted. Erasing the element bumps the generation, so old handles
+/// stop matching instead of referring to whatever is inserted into the slot next.
+class SlotMapHandle
+{
+public:
+    static constexpr s32 cIndexBits = 20;
+    static constexpr u32 cIndexMask = (1u << cIndexBits) - 1;
+    /// Generations wrap around to 1, so 0 never refers to an element.
+    static constexpr u32 cGenerationMax = (1u << (32 - cIndexBits)) - 1;
+
+    constexpr SlotMapHandle() = default;
+    constexpr SlotMapHandle(u32 index, u32 generation)
+        : mValue((generation << cIndexBits) | index)
+    {
+    }
+
+    static constexpr SlotMapHandle fromU32(u32 value)
+    {
+        SlotMapHandle handle;
+        handle.mValue = value;
+        return handle;
+    }
+
+    constexpr u32 getIndex() const { return mValue & cIndexMask; }
+    constexpr u32 getGeneration() const { return mValue >> cIndexBits; }
+    constexpr u32 toU32() const { return mValue; }
+    constexpr bool isValid() const { return mValue != 0; }
+
+    constexpr bool operator==(const SlotMapHandle& rhs) const { return mValue == rhs.mValue; }
+    constexpr bool operator!=(const SlotMapHandle& rhs) const { return mValue != rhs.mValue; }
+
+private:
+    u32 mValue = 0;
+};
+
+/// Container with stable handles and dense storage, for objects that are created and destroyed
+/// often and iterated every frame.
+///
+/// The elements are stored contiguously, in no particular order: erase moves the last element
+/// into the hole. The slots (one per capacity) map handles to the current position of their
+/// element, so a lookup is two array accesses, and pointers to elements are only valid until
+/// the next erase. Iteration runs over the dense array only.
+template <typename T>
+class SlotMap
+{
+public:
+    using Handle = SlotMapHandle;
+
+    SlotMap() = default;
+    SlotMap(const SlotMap&) = delete;
+    SlotMap& operator=(const SlotMap&) = delete;
+
+    static constexpr size_t calcSlotsOffset(s32 capacity)
+    {
+        const size_t size = sizeof(T) * static_cast<size_t>(capacity);
+        return (size + alignof(Slot) - 1) / alignof(Slot) * alignof(Slot);
+    }
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity)
+    {
+        return calcSlotsOffset(capacity) +
+               (sizeof(Slot) + sizeof(u32)) * static_cast<size_t>(capacity);
+    }
+
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity) bytes long and aligned for T and u32.
+    void setBuffer(s32 capacity, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mValues != nullptr; }
+
+    bool isEmpty() const { return mSize == 0; }
+    bool isFull() const { return mSize >= mCapacity; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+
+    /// Returns an invalid handle if the map is full.
+    Handle insert(const T& value) { return emplace(value); }
+    Handle insert(T&& value) { return emplace(std::move(value)); }
+    template <typename... Args>
+    Handle emplace(Args&&... args);
+
+    T* get(Handle handle) const
+    {
+        const Slot* slot = getSlot_(handle);
+        return slot ? &mValues[slot->dense_index] : nullptr;
+    }
+    bool contains(Handle handle) const { return getSlot_(handle) != nullptr; }
+
+    /// Returns whether an element was erased.
+    bool erase(Handle handle);
+    void clear();
+
+    /// Elements in storage order, for dense iteration. Indices are not stable.
+    T* begin() const { return mValues; }
+    T* end() const { return mValues + mSize; }
+    T& operator[](s32 index) const
+    {
+        SEAD_ASSERT_MSG(u32(index) < u32(mSize), "index exceeded [%d/%d]", index, mSize);
+        return mValues[index];
+    }
+    /// Handle of the element at `index` in storage order.
+    Handle getHandle(s32 index) const
+    {
+        SEAD_ASSERT_MSG(u32(index) < u32(mSize), "index exceeded [%d/%d]", index, mSize);
+        const u32 slot_index = mDenseToSlot[index];
+        return Handle(slot_index, mSlots[slot_index].generation);
+    }
+
+    // Callable must have the signature Handle, T&
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        for (s32 i = 0; i < mSize; ++i)
+            callable(Handle(mDenseToSlot[i], mSlots[mDenseToSlot[i]].generation), mValues[i]);
+    }
+
+protected:
+    struct Slot
+    {
+        /// Position of the element if the slot is used, next free slot otherwise.
+        u32 dense_index;
+        u32 generation;
+    };
+
+    static constexpr u32 cFreeListEnd = SlotMapHandle::cIndexMask;
+
+    const Slot* getSlot_(Handle handle) const
+    {
+        const u32 index = handle.getIndex();
+        if (index >= u32(mCapacity))
+            return nullptr;
+        const Slot* slot = &mSlots[index];
+        // Free slots do not match any handle either: erase bumps the generation.
+        if (slot->generation != handle.getGeneration() || slot->dense_index >= u32(mSize) ||
+            mDenseToSlot[slot->dense_index] != index)
+        {
+            return nullptr;
+        }
+        return slot;
+    }
+
+    T* mValues = nullptr;
+    Slot* mSlots = nullptr;
+    u32* mDenseToSlot = nullptr;
+    s32 mSize = 0;
+    s32 mCapacity = 0;
+    u32 mFreeHead = cFreeListEnd;
+};
+
+template <typename T, s32 N>
+class FixedSlotMap : public SlotMap<T>
+{
+public:
+    FixedSlotMap() { SlotMap<T>::setBuffer(N, &mWork); }
+    ~FixedSlotMap() { SlotMap<T>::clear(); }
+
+    void setBuffer(s32 capacity, void* buffer) = delete;
+    void allocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    std::aligned_storage_t<SlotMap<T>::calculateWorkBufferSize(N),
+                           std::max(alignof(T), alignof(u32))>
+        mWork;
+};
+
+template <typename T>
+inline void SlotMap<T>::allocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity), alignment);
+}
+
+template <typename T>
+inline bool SlotMap<T>::tryAllocBuffer(s32 capacity, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mValues == nullptr);
+
+    if (capacity < 1 || u32(capacity) > SlotMapHandle::cIndexMask)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] must be in [1, %u]", capacity,
+                        SlotMapHandle::cIndexMask);
+        return false;
+    }
+
+    alignment =
+        std::max({alignment, static_cast<s32>(alignof(T)), static_cast<s32>(alignof(u32))});
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, buf);
+    return true;
+}
+
+template <typename T>
+inline void SlotMap<T>::setBuffer(s32 capacity, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    SEAD_ASSERT_MSG(u32(capacity) <= SlotMapHandle::cIndexMask, "capacity[%d] is too large",
+                    capacity);
+    mValues = static_cast<T*>(buffer);
+    mSlots = reinterpret_cast<Slot*>(static_cast<u8*>(buffer) + calcSlotsOffset(capacity));
+    mDenseToSlot = reinterpret_cast<u32*>(mSlots + capacity);
+    mSize = 0;
+    mCapacity = capacity;
+
+    for (s32 i = 0; i < capacity; ++i)
+    {
+        mSlots[i].dense_index = i + 1 < capacity ? u32(i + 1) : cFreeListEnd;
+        mSlots[i].generation = 1;
+    }
+    mFreeHead = 0;
+}
+
+template <typename T>
+inline void SlotMap<T>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mValues);
+    mValues = nullptr;
+    mSlots = nullptr;
+    mDenseToSlot = nullptr;
+    mCapacity = 0;
+    mFreeHead = cFreeListEnd;
+}
+
+template <typename T>
+template <typename... Args>
+inline SlotMapHandle SlotMap<T>::emplace(Args&&... args)
+{
+    if (isFull())
+    {
+        SEAD_ASSERT_MSG(false, "map is full.");
+        return Handle();
+    }
+
+    const u32 slot_index = mFreeHead;
+    Slot& slot = mSlots[slot_index];
+    mFreeHead = slot.dense_index;
+
+    new (&mValues[mSize]) T(std::forward<Args>(args)...);
+    slot.dense_index = u32(mSize);
+    mDenseToSlot[mSize] = slot_index;
+    ++mSize;
+    return Handle(slot_index, slot.generation);
+}
+
+template <typename T>
+inline bool SlotMap<T>::erase(Handle handle)
+{
+    Slot* slot = const_cast<Slot*>(getSlot_(handle));
+    if (!slot)
+        return false;
+
+    // Move the last element into the hole.
+    const u32 dense_index = slot->dense_index;
+    const u32 last = u32(mSize - 1);
+    if (dense_index != last)
+    {
+        mValues[dense_index] = std::move(mValues[last]);
+        mDenseToSlot[dense_index] = mDenseToSlot[last];
+        mSlots[mDenseToSlot[last]].dense_index = dense_index;
+    }
+    mValues[last].~T();
+    --mSize;
+
+    slot->generation =
+        slot->generation == SlotMapHandle::cGenerationMax ? 1 : slot->generation + 1;
+    slot->dense_index = mFreeHead;
+    mFreeHead = handle.getIndex();
+    return true;
+}
+
+template <typename T>
+inline void SlotMap<T>::clear()
+{
+    while (mSize > 0)
+        erase(getHandle(mSize - 1));
+}
+
+}  // namespace sead
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Growable array that stores up to N elements inline and only allocates from a Heap when it
+/// grows past N, for temporary arrays that are usually small but have no hard upper bound.
+///
+/// Unlike SafeArray, it never overflows; unlike ObjArray, small arrays cost no allocation. Once
+/// the elements are on the heap the capacity doubles on every growth, and the buffer is only
+/// freed by the destructor or shrinkToFit. Pointers to elements are invalidated by growth and by
+/// moving the array. Moving an array whose elements are on the heap transfers the buffer, so
+/// returning one from a function is cheap; inline elements are moved one by one.
+///
+/// Growth allocates from the heap given to the constructor, or the current heap if it is null.
+/// If an allocation fails, the insertion asserts and returns null (or false) and the array is
+/// left unchanged.
+template <typename T, s32 N>
+class SmallVector
+{
+    static_assert(N > 0, "N must be positive");
+
+public:
+    explicit SmallVector(Heap* heap = nullptr) : mHeap(heap) {}
+    SmallVector(const SmallVector&) = delete;
+    SmallVector& operator=(const SmallVector&) = delete;
+    SmallVector(SmallVector&& other) : mHeap(other.mHeap) { moveFrom_(other); }
+    SmallVector& operator=(SmallVector&& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            freeHeapBuffer_();
+            mHeap = other.mHeap;
+            moveFrom_(other);
+        }
+        return *this;
+    }
+    ~SmallVector()
+    {
+        clear();
+        freeHeapBuffer_();
+    }
+
+    bool isEmpty() const { return mSize == 0; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+    /// Whether the elements are in the inline storage (no heap buffer is owned).
+    bool isInline() const { return static_cast<const void*>(mData) == mInline; }
+    Heap* getHeap() const { return mHeap; }
+
+    T* data() const { return mData; }
+    T* begin() const { return mData; }
+    T* end() const { return mData + mSize; }
+    T& operator[](s32 index) const
+    {
+        SEAD_ASSERT_MSG(u32(index) < u32(mSize), "index exceeded [%d/%d]", index, mSize);
+        return mData[index];
+    }
+    T& front() const { return operator[](0); }
+    T& back() const { return operator[](mSize - 1); }
+
+    T* pushBack(const T& value) { return emplaceBack(value); }
+    T* pushBack(T&& value) { return emplaceBack(std::move(value)); }
+    /// Returns the new element, or nullptr if growing failed.
+    template <typename... Args>
+    T* emplaceBack(Args&&... args);
+    /// Inserts before the element at `index` (0 <= index <= size()), shifting the following
+    /// elements. Returns the new element, or nullptr if growing failed.
+    T* insert(s32 index, const T& value);
+    void popBack();
+    /// Erases the element at `index`, shifting the following elements to keep the order.
+    void erase(s32 index);
+    /// Erases the element at `index` by moving the last element into its place.
+    void eraseUnordered(s32 index);
+    void clear();
+
+    /// Makes room for `capacity` elements. Returns false if the allocation failed.
+    bool reserve(s32 capacity);
+    /// Grows with default-constructed elements or shrinks to `size` elements.
+    bool resize(s32 size);
+    /// Moves the elements back to the inline storage if they fit, or to a heap buffer of the
+    /// exact size otherwise.
+    void shrinkToFit();
+
+    static constexpr s32 cInlineCapacity = N;
+
+private:
+    T* getInlineData_() { return reinterpret_cast<T*>(mInline); }
+
+    /// Moves the elements to a buffer of `capacity` elements (at least size()), which is the
+    /// inline storage if `capacity` is N. Returns false if the allocation failed.
+    bool reallocate_(s32 capacity);
+    T* allocate_(s32 capacity)
+    {
+        const size_t size = sizeof(T) * static_cast<size_t>(capacity);
+        auto* buf =
+            new (mHeap, std::max<s32>(alignof(T), sizeof(void*)), std::nothrow) u8[size];
+        if (!buf)
+            SEAD_ASSERT_MSG(false, "alloc failed [%zu]", size);
+        return reinterpret_cast<T*>(buf);
+    }
+    void freeHeapBuffer_()
+    {
+        if (!isInline())
+            delete[] reinterpret_cast<u8*>(mData);
+        mData = getInlineData_();
+        mCapacity = N;
+    }
+    s32 calcGrownCapacity_() const { return mCapacity * 2; }
+    static void moveElements_(T* dst, T* src, s32 num)
+    {
+        std::uninitialized_move(src, src + num, dst);
+        std::destroy(src, src + num);
+    }
+    void moveFrom_(SmallVector& other);
+
+    T* mData = getInlineData_();
+    s32 mSize = 0;
+    s32 mCapacity = N;
+    Heap* mHeap;
+    std::aligned_storage_t<sizeof(T), alignof(T)> mInline[N];
+};
+
+template <typename T, s32 N>
+template <typename... Args>
+inline T* SmallVector<T, N>::emplaceBack(Args&&... args)
+{
+    if (mSize < mCapacity)
+    {
+        T* element = new (mData + mSize) T(std::forward<Args>(args)...);
+        ++mSize;
+        return element;
+    }
+
+    // Construct the new element before moving the others, since the arguments may refer to
+    // them.
+    const s32 capacity = calcGrownCapacity_();
+    T* data = allocate_(capacity);
+    if (!data)
+        return nullptr;
+
+    T* element = new (data + mSize) T(std::forward<Args>(args)...);
+    moveElements_(data, mData, mSize);
+    freeHeapBuffer_();
+    mData = data;
+    mCapacity = capacity;
+    ++mSize;
+    return element;
+}
+
+template <typename T, s32 N>
+inline T* SmallVector<T, N>::insert(s32 index, const T& value)
+{
+    if (u32(index) > u32(mSize))
+    {
+        SEAD_ASSERT_MSG(false, "index exceeded [%d/%d]", index, mSize);
+        return nullptr;
+    }
+
+    if (index == mSize)
+        return emplaceBack(value);
+
+    // Copy first: value may be an element that is about to move.
+    T copy(value);
+    if (!emplaceBack(std::move(mData[mSize - 1])))
+        return nullptr;
+    std::move_backward(mData + index, mData + mSize - 2, mData + mSize - 1);
+    mData[index] = std::move(copy);
+    return &mData[index];
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::popBack()
+{
+    SEAD_ASSERT_MSG(mSize > 0, "vector is empty.");
+    if (mSize > 0)
+        mData[--mSize].~T();
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::erase(s32 index)
+{
+    if (u32(index) >= u32(mSize))
+    {
+        SEAD_ASSERT_MSG(false, "index exceeded [%d/%d]", index, mSize);
+        return;
+    }
+
+    std::move(mData + index + 1, mData + mSize, mData + index);
+    mData[--mSize].~T();
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::eraseUnordered(s32 index)
+{
+    if (u32(index) >= u32(mSize))
+    {
+        SEAD_ASSERT_MSG(false, "index exceeded [%d/%d]", index, mSize);
+        return;
+    }
+
+    if (index != mSize - 1)
+        mData[index] = std::move(mData[mSize - 1]);
+    mData[--mSize].~T();
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::clear()
+{
+    std::destroy(mData, mData + mSize);
+    mSize = 0;
+}
+
+template <typename T, s32 N>
+inline bool SmallVector<T, N>::reserve(s32 capacity)
+{
+    if (capacity <= mCapacity)
+        return true;
+    return reallocate_(capacity);
+}
+
+template <typename T, s32 N>
+inline bool SmallVector<T, N>::resize(s32 size)
+{
+    if (size < mSize)
+    {
+        std::destroy(mData + size, mData + mSize);
+        mSize = size;
+        return true;
+    }
+
+    if (size > mCapacity && !reallocate_(std::max(size, calcGrownCapacity_())))
+        return false;
+    std::uninitialized_value_construct(mData + mSize, mData + size);
+    mSize = size;
+    return true;
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::shrinkToFit()
+{
+    if (!isInline() && mSize < mCapacity)
+        reallocate_(std::max(mSize, N));
+}
+
+template <typename T, s32 N>
+inline bool SmallVector<T, N>::reallocate_(s32 capacity)
+{
+    T* data = capacity == N ? getInlineData_() : allocate_(capacity);
+    if (!data)
+        return false;
+
+    moveElements_(data, mData, mSize);
+    freeHeapBuffer_();
+    mData = data;
+    mCapacity = capacity;
+    return true;
+}
+
+template <typename T, s32 N>
+inline void SmallVector<T, N>::moveFrom_(SmallVector& other)
+{
+    if (other.isInline())
+    {
+        moveElements_(mData, other.mData, other.mSize);
+    }
+    else
+    {
+        mData = other.mData;
+        mCapacity = other.mCapacity;
+        other.mData = other.getInlineData_();
+        other.mCapacity = N;
+    }
+    mSize = other.mSize;
+    other.mSize = 0;
+}
+
+}  // namespace sead
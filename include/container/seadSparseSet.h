@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+
+namespace sead
+{
+class Heap;
+
+/// Map from small integer keys (e.g. entity IDs from an external allocator) to values stored
+/// contiguously, like a SlotMap whose handles are chosen by the user.
+///
+/// A sparse array with one entry per possible key gives the position of the value of every key
+/// in the dense arrays; erase moves the last element into the hole. Lookups, insertions and
+/// erasures are O(1), and iteration runs over the dense array only. The sparse array costs
+/// 4 bytes per possible key, so the keys should be in a compact range [0, key_range).
+template <typename T>
+class SparseSet
+{
+public:
+    SparseSet() = default;
+    SparseSet(const SparseSet&) = delete;
+    SparseSet& operator=(const SparseSet&) = delete;
+
+    static constexpr size_t calcKeysOffset(s32 capacity)
+    {
+        const size_t size = sizeof(T) * static_cast<size_t>(capacity);
+        return (size + alignof(u32) - 1) / alignof(u32) * alignof(u32);
+    }
+
+    static constexpr size_t calculateWorkBufferSize(s32 capacity, s32 key_range)
+    {
+        return calcKeysOffset(capacity) +
+               sizeof(u32) * (static_cast<size_t>(capacity) + static_cast<size_t>(key_range));
+    }
+
+    void allocBuffer(s32 capacity, s32 key_range, Heap* heap, s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, s32 key_range, Heap* heap, s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity, key_range) bytes long and aligned for
+    /// T and u32.
+    void setBuffer(s32 capacity, s32 key_range, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mValues != nullptr; }
+
+    bool isEmpty() const { return mSize == 0; }
+    bool isFull() const { return mSize >= mCapacity; }
+    s32 size() const { return mSize; }
+    s32 capacity() const { return mCapacity; }
+    s32 getKeyRange() const { return mKeyRange; }
+
+    /// Inserts a new element, or replaces the value of the existing element with the same key.
+    /// Returns nullptr if the set is full or if the key is out of range.
+    T* insert(u32 key, const T& value);
+
+    T* find(u32 key) const
+    {
+        const s32 index = findIndex(key);
+        return index >= 0 ? &mValues[index] : nullptr;
+    }
+    bool contains(u32 key) const { return findIndex(key) >= 0; }
+    /// Returns the position of the element in storage order, or -1.
+    s32 findIndex(u32 key) const
+    {
+        if (key >= u32(mKeyRange))
+            return -1;
+        const u32 index = mSparse[key];
+        return index != cInvalidIndex ? s32(index) : -1;
+    }
+
+    /// Returns whether an element was erased.
+    bool erase(u32 key);
+    void clear();
+
+    /// Elements in storage order, for dense iteration. Indices are not stable.
+    T* begin() const { return mValues; }
+    T* end() const { return mValues + mSize; }
+    T& operator[](s32 index) const
+    {
+        SEAD_ASSERT_MSG(u32(index) < u32(mSize), "index exceeded [%d/%d]", index, mSize);
+        return mValues[index];
+    }
+    /// Key of the element at `index` in storage order.
+    u32 getKey(s32 index) const
+    {
+        SEAD_ASSERT_MSG(u32(index) < u32(mSize), "index exceeded [%d/%d]", index, mSize);
+        return mDenseKeys[index];
+    }
+
+    // Callable must have the signature u32, T&
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        for (s32 i = 0; i < mSize; ++i)
+            callable(mDenseKeys[i], mValues[i]);
+    }
+
+private:
+    static constexpr u32 cInvalidIndex = 0xffffffff;
+
+    T* mValues = nullptr;
+    u32* mDenseKeys = nullptr;
+    u32* mSparse = nullptr;
+    s32 mSize = 0;
+    s32 mCapacity = 0;
+    s32 mKeyRange = 0;
+};
+
+template <typename T, s32 N, s32 KeyRange>
+class FixedSparseSet : public SparseSet<T>
+{
+public:
+    FixedSparseSet() { SparseSet<T>::setBuffer(N, KeyRange, &mWork); }
+    ~FixedSparseSet() { SparseSet<T>::clear(); }
+
+    void setBuffer(s32 capacity, s32 key_range, void* buffer) = delete;
+    void allocBuffer(s32 capacity, s32 key_range, Heap* heap,
+                     s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, s32 key_range, Heap* heap,
+                        s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    std::aligned_storage_t<SparseSet<T>::calculateWorkBufferSize(N, KeyRange),
+                           std::max(alignof(T), alignof(u32))>
+        mWork;
+};
+
+template <typename T>
+inline void SparseSet<T>::allocBuffer(s32 capacity, s32 key_range, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, key_range, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity, key_range), alignment);
+}
+
+template <typename T>
+inline bool SparseSet<T>::tryAllocBuffer(s32 capacity, s32 key_range, Heap* heap,
+                                         s32 alignment)
+{
+    SEAD_ASSERT(mValues == nullptr);
+
+    if (capacity < 1 || key_range < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] and key_range[%d] must be larger than zero",
+                        capacity, key_range);
+        return false;
+    }
+
+    alignment =
+        std::max({alignment, static_cast<s32>(alignof(T)), static_cast<s32>(alignof(u32))});
+    auto* buf =
+        new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(capacity, key_range)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, key_range, buf);
+    return true;
+}
+
+template <typename T>
+inline void SparseSet<T>::setBuffer(s32 capacity, s32 key_range, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mValues = static_cast<T*>(buffer);
+    mDenseKeys = reinterpret_cast<u32*>(static_cast<u8*>(buffer) + calcKeysOffset(capacity));
+    mSparse = mDenseKeys + capacity;
+    mSize = 0;
+    mCapacity = capacity;
+    mKeyRange = key_range;
+    std::fill_n(mSparse, key_range, cInvalidIndex);
+}
+
+template <typename T>
+inline void SparseSet<T>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    clear();
+    delete[] reinterpret_cast<u8*>(mValues);
+    mValues = nullptr;
+    mDenseKeys = nullptr;
+    mSparse = nullptr;
+    mCapacity = 0;
+    mKeyRange = 0;
+}
+
+template <typename T>
+inline T* SparseSet<T>::insert(u32 key, const T& value)
+{
+    if (key >= u32(mKeyRange))
+    {
+        SEAD_ASSERT_MSG(false, "key[%u] is out of range [0, %d)", key, mKeyRange);
+        return nullptr;
+    }
+
+    if (mSparse[key] != cInvalidIndex)
+    {
+        T* existing = &mValues[mSparse[key]];
+        *existing = value;
+        return existing;
+    }
+
+    if (isFull())
+    {
+        SEAD_ASSERT_MSG(false, "set is full.");
+        return nullptr;
+    }
+
+    T* element = new (&mValues[mSize]) T(value);
+    mDenseKeys[mSize] = key;
+    mSparse[key] = u32(mSize);
+    ++mSize;
+    return element;
+}
+
+template <typename T>
+inline bool SparseSet<T>::erase(u32 key)
+{
+    const s32 index = findIndex(key);
+    if (index < 0)
+        return false;
+
+    // Move the last element into the hole.
+    const s32 last = mSize - 1;
+    if (index != last)
+    {
+        mValues[index] = std::move(mValues[last]);
+        mDenseKeys[index] = mDenseKeys[last];
+        mSparse[mDenseKeys[index]] = u32(index);
+    }
+    mValues[last].~T();
+    mSparse[key] = cInvalidIndex;
+    --mSize;
+    return true;
+}
+
+template <typename T>
+inline void SparseSet<T>::clear()
+{
+    for (s32 i = 0; i < mSize; ++i)
+    {
+        mValues[i].~T();
+        mSparse[mDenseKeys[i]] = cInvalidIndex;
+    }
+    mSize = 0;
+}
+
+}  // namespace sead
@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+#include "codec/seadHashCRC32.h"
+#include "container/seadHashMap.h"
+#include "prim/seadMemUtil.h"
+#include "prim/seadSafeString.h"
+
+namespace sead
+{
+class Heap;
+
+/// Unordered associative container with string keys, for name -> object registries.
+///
+/// Keys are identified by their HashCRC32::calcStringHash value: the elements are stored in a
+/// HashMap keyed by that hash, and the strings are copied once into a shared key buffer that the
+/// elements refer to by offset. Two keys with the same hash cannot be in the map together
+/// (insert fails with an assertion), so a lookup by hash is exact and needs no string compare.
+/// Hot lookups can hash their key at compile time:
+///     constexpr u32 cPlayerHash = StrHashMap<Actor*>::calcHash("Player");
+///     Actor** actor = map.find(cPlayerHash);
+///
+/// The key buffer only has to hold the live keys: erase moves the keys after the erased one
+/// down and patches their offsets, which costs O(capacity + key buffer size). Inserting fails
+/// once the live keys (with their null characters) would not fit in key_buffer_size bytes.
+template <typename Value>
+class StrHashMap
+{
+public:
+    StrHashMap() = default;
+    StrHashMap(const StrHashMap&) = delete;
+    StrHashMap& operator=(const StrHashMap&) = delete;
+
+    static constexpr u32 calcHash(const char* key)
+    {
+        return HashCRC32::calcStringHashConstexpr(key);
+    }
+
+    /// `key_buffer_size` is the total size of the keys, including one terminating null
+    /// character per key.
+    static constexpr size_t calculateWorkBufferSize(s32 capacity, s32 key_buffer_size)
+    {
+        return Map::calculateWorkBufferSize(capacity) + static_cast<size_t>(key_buffer_size);
+    }
+
+    void allocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                     s32 alignment = sizeof(void*));
+    bool tryAllocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                        s32 alignment = sizeof(void*));
+    /// `buffer` must be calculateWorkBufferSize(capacity, key_buffer_size) bytes long and aligned
+    /// for Value.
+    void setBuffer(s32 capacity, s32 key_buffer_size, void* buffer);
+    void freeBuffer();
+    bool isBufferReady() const { return mMap.isBufferReady(); }
+
+    bool isEmpty() const { return mMap.isEmpty(); }
+    bool isFull() const { return mMap.isFull(); }
+    s32 size() const { return mMap.size(); }
+    s32 capacity() const { return mMap.capacity(); }
+    s32 getKeyBufferSize() const { return mKeyBufferSize; }
+    s32 getKeyBufferUsed() const { return mKeyBufferUsed; }
+
+    /// Inserts a new element, or replaces the value of the existing element with the same key.
+    /// Returns nullptr if the map or the key buffer is full, or if another key has the same hash.
+    Value* insert(const SafeString& key, const Value& value)
+    {
+        return insert(HashCRC32::calcStringHash(key), key, value);
+    }
+    /// `hash` must be the hash of `key`.
+    Value* insert(u32 hash, const SafeString& key, const Value& value);
+
+    Value* find(const SafeString& key) const;
+    /// Finds the element whose key has the hash `hash`, without any string compare.
+    Value* find(u32 hash) const
+    {
+        Entry* entry = mMap.find(hash);
+        return entry ? &entry->value : nullptr;
+    }
+
+    bool erase(const SafeString& key);
+    bool erase(u32 hash);
+    void clear();
+
+    // Callable must have the signature const SafeString&, Value&
+    template <typename Callable>
+    void forEach(const Callable& callable) const
+    {
+        mMap.forEach([this, &callable](const u32&, Entry& entry) {
+            const SafeString key(getKey_(entry));
+            callable(key, entry.value);
+        });
+    }
+
+protected:
+    struct Entry
+    {
+        u32 key_offset;
+        Value value;
+    };
+
+    /// The keys are hashes already.
+    struct IdentityHash
+    {
+        u32 operator()(u32 hash) const { return hash; }
+    };
+
+    using Map = HashMap<u32, Entry, IdentityHash>;
+
+    const char* getKey_(const Entry& entry) const { return mKeyBuffer + entry.key_offset; }
+    /// Removes the key at `offset` from the key buffer.
+    void releaseKey_(u32 offset);
+
+    Map mMap;
+    char* mKeyBuffer = nullptr;
+    s32 mKeyBufferSize = 0;
+    s32 mKeyBufferUsed = 0;
+};
+
+template <typename Value, s32 N, s32 KeyBufferSize>
+class FixedStrHashMap : public StrHashMap<Value>
+{
+public:
+    FixedStrHashMap() { StrHashMap<Value>::setBuffer(N, KeyBufferSize, &mWork); }
+    ~FixedStrHashMap() { StrHashMap<Value>::clear(); }
+
+    void setBuffer(s32 capacity, s32 key_buffer_size, void* buffer) = delete;
+    void allocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                     s32 alignment = sizeof(void*)) = delete;
+    bool tryAllocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                        s32 alignment = sizeof(void*)) = delete;
+    void freeBuffer() = delete;
+
+private:
+    using Entry = typename StrHashMap<Value>::Entry;
+
+    std::aligned_storage_t<StrHashMap<Value>::calculateWorkBufferSize(N, KeyBufferSize),
+                           alignof(Entry)>
+        mWork;
+};
+
+template <typename Value>
+inline void StrHashMap<Value>::allocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                                           s32 alignment)
+{
+    if (!tryAllocBuffer(capacity, key_buffer_size, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(capacity, key_buffer_size), alignment);
+}
+
+template <typename Value>
+inline bool StrHashMap<Value>::tryAllocBuffer(s32 capacity, s32 key_buffer_size, Heap* heap,
+                                              s32 alignment)
+{
+    SEAD_ASSERT(!isBufferReady());
+
+    if (capacity < 1 || key_buffer_size < 1)
+    {
+        SEAD_ASSERT_MSG(false, "capacity[%d] and key_buffer_size[%d] must be larger than zero",
+                        capacity, key_buffer_size);
+        return false;
+    }
+
+    alignment = std::max(alignment, static_cast<s32>(alignof(Entry)));
+    auto* buf = new (heap, alignment, std::nothrow)
+        u8[calculateWorkBufferSize(capacity, key_buffer_size)];
+    if (!buf)
+        return false;
+
+    setBuffer(capacity, key_buffer_size, buf);
+    return true;
+}
+
+template <typename Value>
+inline void StrHashMap<Value>::setBuffer(s32 capacity, s32 key_buffer_size, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mMap.setBuffer(capacity, buffer);
+    mKeyBuffer = static_cast<char*>(buffer) + Map::calculateWorkBufferSize(capacity);
+    mKeyBufferSize = key_buffer_size;
+    mKeyBufferUsed = 0;
+}
+
+template <typename Value>
+inline void StrHashMap<Value>::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    // The key buffer is at the end of the buffer of the map.
+    mMap.freeBuffer();
+    mKeyBuffer = nullptr;
+    mKeyBufferSize = 0;
+    mKeyBufferUsed = 0;
+}
+
+template <typename Value>
+inline Value* StrHashMap<Value>::insert(u32 hash, const SafeString& key, const Value& value)
+{
+    SEAD_ASSERT_MSG(hash == HashCRC32::calcStringHash(key), "wrong hash for key [%s]",
+                    key.cstr());
+
+    if (Entry* entry = mMap.find(hash))
+    {
+        if (!key.isEqual(getKey_(*entry)))
+        {
+            SEAD_ASSERT_MSG(false, "hash collision between [%s] and [%s]", key.cstr(),
+                            getKey_(*entry));
+            return nullptr;
+        }
+        entry->value = value;
+        return &entry->value;
+    }
+
+    if (mMap.isFull())
+    {
+        SEAD_ASSERT_MSG(false, "map is full.");
+        return nullptr;
+    }
+
+    const s32 length = key.calcLength();
+    if (length + 1 > mKeyBufferSize - mKeyBufferUsed)
+    {
+        SEAD_ASSERT_MSG(false, "key buffer is full [%d + %d > %d]", mKeyBufferUsed, length + 1,
+                        mKeyBufferSize);
+        return nullptr;
+    }
+
+    const u32 offset = static_cast<u32>(mKeyBufferUsed);
+    MemUtil::copy(mKeyBuffer + offset, key.cstr(), length);
+    mKeyBuffer[offset + length] = '\0';
+    mKeyBufferUsed += length + 1;
+
+    Entry* entry = mMap.insert(hash, Entry{offset, value});
+    return &entry->value;
+}
+
+template <typename Value>
+inline Value* StrHashMap<Value>::find(const SafeString& key) const
+{
+    Entry* entry = mMap.find(HashCRC32::calcStringHash(key));
+    if (!entry || !key.isEqual(getKey_(*entry)))
+        return nullptr;
+    return &entry->value;
+}
+
+template <typename Value>
+inline bool StrHashMap<Value>::erase(const SafeString& key)
+{
+    const u32 hash = HashCRC32::calcStringHash(key);
+    Entry* entry = mMap.find(hash);
+    if (!entry || !key.isEqual(getKey_(*entry)))
+        return false;
+    return erase(hash);
+}
+
+template <typename Value>
+inline bool StrHashMap<Value>::erase(u32 hash)
+{
+    Entry* entry = mMap.find(hash);
+    if (!entry)
+        return false;
+
+    const u32 offset = entry->key_offset;
+    mMap.erase(hash);
+    releaseKey_(offset);
+    return true;
+}
+
+template <typename Value>
+inline void StrHashMap<Value>::releaseKey_(u32 offset)
+{
+    const s32 length = static_cast<s32>(std::strlen(mKeyBuffer + offset)) + 1;
+    const s32 tail = mKeyBufferUsed - static_cast<s32>(offset) - length;
+    MemUtil::copyOverlap(mKeyBuffer + offset, mKeyBuffer + offset + length, tail);
+    mKeyBufferUsed -= length;
+
+    mMap.forEach([offset, length](const u32&, Entry& entry) {
+        if (entry.key_offset > offset)
+            entry.key_offset -= length;
+    });
+}
+
+template <typename Value>
+inline void StrHashMap<Value>::clear()
+{
+    mMap.clear();
+    mKeyBufferUsed = 0;
+}
+
+}  // namespace sead
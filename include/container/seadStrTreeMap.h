@@ -66,11 +66,26 @@ public:
     void clear();
 
     Node* find(const SafeString& key) const;
+    Node* lowerBound(const SafeString& key) const
+    {
+        return static_cast<Node*>(MapImpl::lowerBound(key));
+    }
+    Node* upperBound(const SafeString& key) const
+    {
+        return static_cast<Node*>(MapImpl::upperBound(key));
+    }
 
     // Callable must have the signature Key&, Value&
     template <typename Callable>
     void forEach(const Callable& delegate) const;
 
+    using iterator = typename MapImpl::template NodeIterator<Node>;
+    iterator begin() const { return iterator(this, startIterating()); }
+    iterator end() const { return iterator(this, nullptr); }
+
+    Node* startIterating() const { return static_cast<Node*>(MapImpl::startIterating()); }
+    Node* nextNode(Node* node) const { return static_cast<Node*>(MapImpl::nextNode(node)); }
+
 private:
     void eraseNodeForClear_(typename MapImpl::Node* node);
 
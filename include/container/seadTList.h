@@ -182,6 +182,30 @@ public:
     };
     RobustRange robustRange() const { return {*this}; }
 
+    /// Calls callable(T&) on the data of every node in order, prefetching the nodes
+    /// PrefetchDistance positions ahead. Faster than the iterators on long lists whose nodes are
+    /// not in the cache. The callable may erase the node it is visiting, but no other node.
+    template <s32 PrefetchDistance = 4, typename Callable>
+    void forEachWithPrefetch(const Callable& callable) const
+    {
+        ListImpl::forEachNodeWithPrefetch_<PrefetchDistance>(
+            0, mCount, [&callable](ListNode* node) {
+                callable(static_cast<TListNode<T>*>(node)->mData);
+            });
+    }
+
+    /// Copies the data of the first `num_max` nodes to `dst`, in order, and returns how many were
+    /// copied. For lists of pointers, traversing the snapshot does not chase a pointer per node,
+    /// which makes repeated traversals of an unchanged list faster.
+    s32 copyTo(T* dst, s32 num_max) const
+    {
+        s32 num = 0;
+        ListImpl::forEachNodeWithPrefetch_<4>(0, num_max, [dst, &num](ListNode* node) {
+            dst[num++] = static_cast<TListNode<T>*>(node)->mData;
+        });
+        return num;
+    }
+
 private:
     static int compareT(const T* a, const T* b)
     {
@@ -13,17 +13,51 @@ class TreeMapNode;
 
 /// Sorted associative container, implemented using a left-leaning red-black tree.
 /// For an explanation of the algorithm, see https://www.cs.princeton.edu/~rs/talks/LLRB/LLRB.pdf
+///
+/// All operations are iterative: insert and erase record the path from the root in a fixed-size
+/// stack and apply the bottom-up fix-ups of the recursive algorithm while walking it back.
 template <typename Key>
 class TreeMapImpl
 {
 public:
     using Node = TreeMapNode<Key>;
 
+    /// In-order iterator. Iterating sets the parent pointers of the nodes that it walks through,
+    /// so the tree must not be modified while it is being iterated.
+    template <typename NodeType>
+    class NodeIterator
+    {
+    public:
+        NodeIterator(const TreeMapImpl* map, NodeType* node) : mMap(map), mNode(node) {}
+
+        NodeType& operator*() const { return *mNode; }
+        NodeType* operator->() const { return mNode; }
+        NodeIterator& operator++()
+        {
+            mNode = static_cast<NodeType*>(mMap->nextNode(mNode));
+            return *this;
+        }
+        bool operator==(const NodeIterator& rhs) const { return mNode == rhs.mNode; }
+        bool operator!=(const NodeIterator& rhs) const { return mNode != rhs.mNode; }
+
+    private:
+        const TreeMapImpl* mMap;
+        NodeType* mNode;
+    };
+
+    using iterator = NodeIterator<Node>;
+
     void insert(Node* node);
+    /// Does nothing if there is no node with this key.
     void erase(const Key& key);
     void clear();
 
     Node* find(const Key& key) const { return find(mRoot, key); }
+    /// Returns the first node whose key is not less than `key`, or nullptr. Iterating from the
+    /// returned node with nextNode visits the following nodes in order.
+    Node* lowerBound(const Key& key) const { return findBound(key, false); }
+    /// Returns the first node whose key is greater than `key`, or nullptr.
+    Node* upperBound(const Key& key) const { return findBound(key, true); }
 
     template <typename Callable>
     void forEach(const Callable& callable) const
@@ -32,6 +66,9 @@ public:
             forEach(mRoot, callable);
     }
 
+    iterator begin() const { return iterator(this, startIterating()); }
+    iterator end() const { return iterator(this, nullptr); }
+
     Node* startIterating() const
     {
         if (!mRoot)
@@ -63,6 +100,11 @@ public:
     }
 
 protected:
+    /// Maximum depth of the paths recorded by insert and erase. The height of a red-black tree
+    /// with n nodes is at most 2 * log2(n + 1), and erase can add a level while moving red nodes
+    /// down, so this is enough for any s32 number of nodes.
+    static constexpr s32 cPathMax = 72;
+
     /// Returns the left most child of a given node, marking each node with its parent
     /// along the way.
     static Node* startIterating(Node* node)
@@ -75,9 +117,8 @@ protected:
         return node;
     }
 
-    Node* insert(Node* root, Node* node);
-    Node* erase(Node* root, const Key& key);
     Node* find(Node* root, const Key& key) const;
+    Node* findBound(const Key& key, bool is_upper) const;
 
     static inline Node* rotateLeft(Node* node);
     static inline Node* rotateRight(Node* node);
@@ -199,11 +240,17 @@ public:
     void clear();
 
     Node* find(const Key& key) const;
+    Node* lowerBound(const Key& key) const { return static_cast<Node*>(MapImpl::lowerBound(key)); }
+    Node* upperBound(const Key& key) const { return static_cast<Node*>(MapImpl::upperBound(key)); }
 
     // Callable must have the signature Key&, Value&
     template <typename Callable>
     void forEach(const Callable& delegate) const;
 
+    using iterator = typename MapImpl::template NodeIterator<Node>;
+    iterator begin() const { return iterator(this, startIterating()); }
+    iterator end() const { return iterator(this, nullptr); }
+
     Node* startIterating() const { return static_cast<Node*>(MapImpl::startIterating()); }
     Node* nextNode(Node* node) const { return static_cast<Node*>(MapImpl::nextNode(node)); }
 
@@ -240,6 +287,8 @@ public:
     using MapImpl = TreeMapImpl<Key>;
 
     Node* find(const Key& key) const { return static_cast<Node*>(MapImpl::find(key)); }
+    Node* lowerBound(const Key& key) const { return static_cast<Node*>(MapImpl::lowerBound(key)); }
+    Node* upperBound(const Key& key) const { return static_cast<Node*>(MapImpl::upperBound(key)); }
 
     // Callable must have the signature Node*
     template <typename Callable>
@@ -251,6 +300,10 @@ public:
         });
     }
 
+    using iterator = typename MapImpl::template NodeIterator<Node>;
+    iterator begin() const { return iterator(this, startIterating()); }
+    iterator end() const { return iterator(this, nullptr); }
+
     Node* startIterating() const { return static_cast<Node*>(MapImpl::startIterating()); }
     Node* nextNode(Node* node) const { return static_cast<Node*>(MapImpl::nextNode(node)); }
 };
@@ -258,102 +311,160 @@ public:
 template <typename Key>
 inline void TreeMapImpl<Key>::insert(Node* node)
 {
-    mRoot = insert(mRoot, node);
-    mRoot->setColor(Node::Color::Black);
-}
+    // links[i] is the pointer to the subtree root at depth i.
+    Node** links[cPathMax];
+    s32 depth = 0;
+    links[0] = &mRoot;
 
-template <typename Key>
-inline TreeMapNode<Key>* TreeMapImpl<Key>::insert(Node* root, Node* node)
-{
-    if (!root)
+    while (Node* const root = *links[depth])
     {
-        node->mLeft = node->mRight = nullptr;
-        node->setColor(Node::Color::Red);
-        return node;
-    }
-
-    const s32 cmp = node->key().compare(root->key());
+        const s32 cmp = node->key().compare(root->key());
+        if (cmp == 0)
+        {
+            if (root != node)
+            {
+                node->mRight = root->mRight;
+                node->mLeft = root->mLeft;
+                node->mColorAndPtr = root->mColorAndPtr;
+                root->erase_();
+                *links[depth] = node;
+            }
+            break;
+        }
 
-    if (cmp < 0)
-    {
-        root->mLeft = insert(root->mLeft, node);
+        SEAD_ASSERT(depth + 1 < cPathMax);
+        links[depth + 1] = cmp < 0 ? &root->mLeft : &root->mRight;
+        ++depth;
     }
-    else if (cmp > 0)
+
+    if (*links[depth])
     {
-        root->mRight = insert(root->mRight, node);
+        // The node replaced an existing one and took its colour: the tree is still balanced.
+        mRoot->setColor(Node::Color::Black);
+        return;
     }
-    else if (root != node)
+
+    node->mLeft = node->mRight = nullptr;
+    node->setColor(Node::Color::Red);
+    *links[depth] = node;
+
+    // A fix-up only looks at the colours of the node, its children and its left grandchild.
+    // Once two consecutive levels are left unchanged, the levels above are as they were before
+    // the insertion, so they need no fix-up either.
+    bool is_child_changed = true;
+    for (--depth; depth >= 0; --depth)
     {
-        node->mRight = root->mRight;
-        node->mLeft = root->mLeft;
-        node->mColorAndPtr = root->mColorAndPtr;
-        root->erase_();
-        root = node;
-    }
+        Node* root = *links[depth];
+        bool is_changed = false;
 
-    if (isRed(root->mRight) && !isRed(root->mLeft))
-        root = rotateLeft(root);
+        if (isRed(root->mRight) && !isRed(root->mLeft))
+        {
+            root = rotateLeft(root);
+            is_changed = true;
+        }
+
+        if (isRed(root->mLeft) && isRed(root->mLeft->mLeft))
+        {
+            root = rotateRight(root);
+            is_changed = true;
+        }
+
+        if (isRed(root->mLeft) && isRed(root->mRight))
+        {
+            flipColors(root);
+            is_changed = true;
+        }
 
-    if (isRed(root->mLeft) && isRed(root->mLeft->mLeft))
-        root = rotateRight(root);
+        if (!is_changed && !is_child_changed)
+            break;
 
-    if (isRed(root->mLeft) && isRed(root->mRight))
-        flipColors(root);
+        *links[depth] = root;
+        is_child_changed = is_changed;
+    }
 
-    return root;
+    mRoot->setColor(Node::Color::Black);
 }
 
 template <typename Key>
 inline void TreeMapImpl<Key>::erase(const Key& key)
 {
-    mRoot = erase(mRoot, key);
-    if (mRoot)
-        mRoot->setColor(Node::Color::Black);
-}
+    if (!mRoot)
+        return;
 
-template <typename Key>
-inline TreeMapNode<Key>* TreeMapImpl<Key>::erase(Node* root, const Key& key)
-{
-    if (key.compare(root->key()) < 0)
-    {
-        if (!isRed(root->mLeft) && !isRed(root->mLeft->mLeft))
-            root = moveRedLeft(root);
-        root->mLeft = erase(root->mLeft, key);
-    }
-    else
+    Node** links[cPathMax];
+    s32 depth = 0;
+    links[0] = &mRoot;
+
+    while (true)
     {
+        Node* root = *links[depth];
+        s32 cmp = key.compare(root->key());
+
+        if (cmp < 0)
+        {
+            // The key is not in the tree. The fix-ups below restore the invariants that the
+            // transformations made on the way down relaxed.
+            if (!root->mLeft)
+                break;
+
+            if (!isRed(root->mLeft) && !isRed(root->mLeft->mLeft))
+                root = moveRedLeft(root);
+            *links[depth] = root;
+            SEAD_ASSERT(depth + 1 < cPathMax);
+            links[depth + 1] = &root->mLeft;
+            ++depth;
+            continue;
+        }
+
         if (isRed(root->mLeft))
+        {
             root = rotateRight(root);
+            cmp = key.compare(root->key());
+        }
 
-        if (key.compare(root->key()) == 0 && !root->mRight)
+        if (cmp == 0 && !root->mRight)
         {
             root->erase_();
-            return nullptr;
+            *links[depth] = nullptr;
+            --depth;
+            break;
+        }
+
+        if (!root->mRight)
+        {
+            *links[depth] = root;
+            break;
         }
 
         if (!isRed(root->mRight) && !isRed(root->mRight->mLeft))
+        {
             root = moveRedRight(root);
+            cmp = key.compare(root->key());
+        }
 
-        if (key.compare(root->key()) == 0)
+        if (cmp == 0)
         {
-            Node* const min_node = findMin(root->mRight);
-
-            Node* target = root->mRight;
-            if (root->mRight)
-                target = find(root->mRight, min_node->key());
-
+            // Replace the node with the minimum of its right subtree.
+            Node* const target = findMin(root->mRight);
             target->mRight = eraseMin(root->mRight);
             target->mLeft = root->mLeft;
             target->mColorAndPtr = root->mColorAndPtr;
             root->erase_();
-            root = target;
-        }
-        else
-        {
-            root->mRight = erase(root->mRight, key);
+            *links[depth] = target;
+            break;
         }
+
+        *links[depth] = root;
+        SEAD_ASSERT(depth + 1 < cPathMax);
+        links[depth + 1] = &root->mRight;
+        ++depth;
     }
-    return fixUp(root);
+
+    for (; depth >= 0; --depth)
+        *links[depth] = fixUp(*links[depth]);
+
+    if (mRoot)
+        mRoot->setColor(Node::Color::Black);
 }
 
 template <typename Key>
@@ -380,19 +491,56 @@ inline TreeMapNode<Key>* TreeMapImpl<Key>::find(Node* root, const Key& key) cons
     return nullptr;
 }
 
+template <typename Key>
+inline TreeMapNode<Key>* TreeMapImpl<Key>::findBound(const Key& key, bool is_upper) const
+{
+    // The result is on the path from the root, so marking the parents along the path is enough
+    // for nextNode to continue from it.
+    Node* result = nullptr;
+    Node* node = mRoot;
+    while (node)
+    {
+        const s32 cmp = key.compare(node->key());
+        Node* next;
+        if (cmp < 0 || (cmp == 0 && !is_upper))
+        {
+            result = node;
+            next = node->mLeft;
+        }
+        else
+        {
+            next = node->mRight;
+        }
+
+        if (next)
+            next->setParent(node);
+        node = next;
+    }
+    return result;
+}
+
 template <typename Key>
 template <typename Callable>
 inline void TreeMapImpl<Key>::forEach(Node* start, const Callable& callable)
 {
-    Node* i = start;
-    do
+    // Every node is read before it is passed to the callable, which is allowed to free it.
+    Node* stack[cPathMax];
+    s32 size = 0;
+    Node* node = start;
+    while (true)
     {
-        Node* node = i;
-        if (i->mLeft)
-            forEach(i->mLeft, callable);
-        i = i->mRight;
-        callable(node);
-    } while (i);
+        for (; node; node = node->mLeft)
+        {
+            SEAD_ASSERT(size < cPathMax);
+            stack[size++] = node;
+        }
+        if (size == 0)
+            break;
+
+        Node* const current = stack[--size];
+        node = current->mRight;
+        callable(current);
+    }
 }
 
 template <typename Key>
@@ -452,21 +600,34 @@ inline TreeMapNode<Key>* TreeMapImpl<Key>::findMin(Node* node)
     return node;
 }
 
-// NON_MATCHING: this version matches the LLRB tree implementation and is better optimized
 template <typename Key>
 inline TreeMapNode<Key>* TreeMapImpl<Key>::eraseMin(Node* node)
 {
-    if (!node->mLeft)
-        return nullptr;
+    Node** links[cPathMax];
+    s32 depth = 0;
+    links[0] = &node;
 
-    if (!isRed(node->mLeft) && !isRed(node->mLeft->mLeft))
-        node = moveRedLeft(node);
+    while (true)
+    {
+        Node* root = *links[depth];
+        if (!root->mLeft)
+        {
+            *links[depth] = nullptr;
+            --depth;
+            break;
+        }
+
+        if (!isRed(root->mLeft) && !isRed(root->mLeft->mLeft))
+            root = moveRedLeft(root);
+        *links[depth] = root;
+        SEAD_ASSERT(depth + 1 < cPathMax);
+        links[depth + 1] = &root->mLeft;
+        ++depth;
+    }
 
-    node->mLeft = eraseMin(node->mLeft);
-#ifdef MATCHING_HACK_NX_CLANG
-    asm("");
-#endif
-    return fixUp(node);
+    for (; depth >= 0; --depth)
+        *links[depth] = fixUp(*links[depth]);
+    return node;
 }
 
 template <typename Key>
@@ -2,6 +2,7 @@
 #define SEAD_TREENODE_H_
 
 #include <basis/seadTypes.h>
+#include <prim/seadMemUtil.h>
 
 namespace sead
 {
@@ -22,6 +23,29 @@ public:
     void pushBackSibling(TreeNode* node);
     void pushFrontChild(TreeNode* node);
 
+    /// Calls callable(TreeNode*) on this node and all its descendants in pre-order (a node
+    /// before its children, siblings in order). The children of a node are prefetched while it is
+    /// visited, and the next sibling of a child while the subtree of the child is visited. The
+    /// callable must not change the links of the tree.
+    template <typename Callable>
+    void forEachSubTreeNode(const Callable& callable)
+    {
+        if (mChild)
+            MemUtil::prefetch(mChild);
+        callable(this);
+        for (TreeNode* node = mChild; node; node = node->mNext)
+        {
+            if (node->mNext)
+                MemUtil::prefetch(node->mNext);
+            node->forEachSubTreeNode(callable);
+        }
+    }
+
+    /// Copies pointers to the first `num_max` nodes of the subtree to `dst` in pre-order, and
+    /// returns how many were copied. Traversing the snapshot does not chase pointers, which
+    /// makes repeated traversals of an unchanged tree faster.
+    s32 copySubTreeTo(TreeNode** dst, s32 num_max);
+
 protected:
     void clearChildLinksRecursively_();
 
@@ -53,6 +77,23 @@ public:
     void pushBackSibling(TTreeNode* node) { TreeNode::pushBackSibling(node); }
     void pushFrontChild(TTreeNode* node) { TreeNode::pushFrontChild(node); }
 
+    template <typename Callable>
+    void forEachSubTreeNode(const Callable& callable)
+    {
+        TreeNode::forEachSubTreeNode(
+            [&callable](TreeNode* node) { callable(static_cast<TTreeNode*>(node)); });
+    }
+
+    s32 copySubTreeTo(TTreeNode** dst, s32 num_max)
+    {
+        s32 num = 0;
+        forEachSubTreeNode([dst, num_max, &num](TTreeNode* node) {
+            if (num < num_max)
+                dst[num++] = node;
+        });
+        return num;
+    }
+
     // TODO: probably iterators
 
 protected:
@@ -6,6 +6,7 @@
 #endif  // cafe
 
 #include <basis/seadTypes.h>
+#include <container/seadSafeArray.h>
 #include <container/seadTList.h>
 #include <filedevice/seadFileDevice.h>
 #include <filedevice/seadMainFileDevice.h>
@@ -30,7 +31,13 @@ public:
     void unmount(FileDevice* device);
     void unmount(const SafeString& name);
     FileDevice* findDeviceFromPath(const SafeString& path, BufferedSafeString* pathNoDrive) const;
+    /// Same as findDeviceFromPath, but pathNoDrive is set to a view into `path`
+    /// so that no path is copied.
+    FileDevice* findDeviceFromPath(const SafeString& path, SafeString* pathNoDrive) const;
     FileDevice* findDevice(const SafeString& name) const;
+    /// @param name    Drive name (does not need to be null terminated)
+    /// @param length  Length of the drive name
+    FileDevice* findDevice(const char* name, s32 length) const;
 
     FileDevice* tryOpen(FileHandle* handle, const SafeString& path, FileDevice::FileOpenFlag flag,
                         u32 divSize);
@@ -55,10 +62,26 @@ public:
 private:
     typedef TList<FileDevice*> DeviceList;
 
+    /// Drive name hash table slot. Slots are filled with open addressing and hold the first
+    /// mounted device for each drive name, like the linear search over mDeviceList.
+    struct DeviceSlot
+    {
+        u32 hash;
+        FileDevice* device;
+    };
+
+    static const s32 cDeviceTableSize = 64;
+
     void mount_(Heap* heap);
     void unmount_();
 
+    void insertDeviceSlot_(FileDevice* device);
+    void rebuildDeviceTable_();
+    FileDevice* searchDeviceList_(const char* name, s32 length) const;
+
     DeviceList mDeviceList{};
+    SafeArray<DeviceSlot, cDeviceTableSize> mDeviceTable{};
+    s32 mNumDeviceSlots = 0;
     FileDevice* mDefaultFileDevice = nullptr;
     MainFileDevice* mMainFileDevice = nullptr;
 
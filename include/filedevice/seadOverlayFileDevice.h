@@ -0,0 +1,95 @@
+#pragma once
+
+#include "container/seadBuffer.h"
+#include "filedevice/seadFileDevice.h"
+
+namespace sead
+{
+class Heap;
+
+/// A read-only file device that stacks several devices (typically ArchiveFileDevices for a base
+/// archive followed by DLC and patch archives). Layers that are added later take precedence.
+///
+/// When a layer is added, its files are enumerated and a merged path hash index is updated so
+/// that every lookup is resolved to the winning layer with a single probe, however many layers
+/// are mounted. Only the winning layer is then asked for the file.
+/// Paths that are in none of the layers are rejected without touching any layer.
+///
+/// Layers must be enumerable through openDirectory/readDirectory (archive devices list every
+/// file from the root directory). Directory listings are not merged: openDirectory is forwarded
+/// to the topmost layer that can open the directory.
+class OverlayFileDevice : public FileDevice
+{
+    SEAD_RTTI_OVERRIDE(OverlayFileDevice, FileDevice)
+public:
+    OverlayFileDevice();
+    ~OverlayFileDevice() override;
+
+    /// @param max_layers  Maximum number of layers
+    /// @param max_files   Maximum number of distinct paths over all layers
+    void allocBuffer(s32 max_layers, s32 max_files, Heap* heap);
+    void freeBuffer();
+    bool isBufferReady() const { return mLayers.isBufferReady(); }
+
+    /// Adds a layer on top of all other layers.
+    bool addLayer(FileDevice* device);
+    /// Removes a layer. The index is rebuilt from the remaining layers.
+    bool removeLayer(FileDevice* device);
+    void clearLayers();
+    s32 getNumLayers() const { return mNumLayers; }
+    FileDevice* getLayer(s32 idx) const { return mLayers[idx]; }
+
+    /// Returns the layer that provides the specified file, or null if no layer has it.
+    FileDevice* findLayer(const SafeString& path);
+
+    void resolveFilePath(BufferedSafeString* out, const SafeString& path) const override;
+    bool isMatchDevice_(const HandleBase* handle) const override;
+
+protected:
+    struct IndexEntry
+    {
+        u32 hash;
+        /// Index of the topmost layer that has a file with this hash, or -1 if unused.
+        s32 layer;
+    };
+
+    static const s32 cEnumerateDepthMax = 8;
+
+    bool doIsAvailable_() const override { return mNumLayers > 0; }
+    u8* doLoad_(LoadArg& arg) override;
+    FileDevice* doOpen_(FileHandle* handle, const SafeString& path, FileOpenFlag flag) override;
+    bool doClose_(FileHandle* handle) override;
+    bool doFlush_(FileHandle* handle) override;
+    bool doRemove_(const SafeString& str) override;
+    bool doRead_(u32* bytesRead, FileHandle* handle, u8* outBuffer, u32 bytesToRead) override;
+    bool doWrite_(u32*, FileHandle*, const u8*, u32) override { return false; }
+    bool doSeek_(FileHandle* handle, s32 offset, SeekOrigin origin) override;
+    bool doGetCurrentSeekPos_(u32* seekPos, FileHandle* handle) override;
+    bool doGetFileSize_(u32* fileSize, const SafeString& path) override;
+    bool doGetFileSize_(u32* fileSize, FileHandle* handle) override;
+    bool doIsExistFile_(bool* exists, const SafeString& path) override;
+    bool doIsExistDirectory_(bool* exists, const SafeString& path) override;
+    FileDevice* doOpenDirectory_(DirectoryHandle* handle, const SafeString& path) override;
+    bool doCloseDirectory_(DirectoryHandle* handle) override;
+    bool doReadDirectory_(u32* entriesRead, DirectoryHandle* handle, DirectoryEntry* entries,
+                          u32 entriesToRead) override;
+    bool doMakeDirectory_(const SafeString&, u32) override { return false; }
+    s32 doGetLastRawError_() const override { return 0; }
+
+    /// Returns the index of the topmost layer that may have the file, or -1.
+    s32 searchIndex_(const SafeString& path) const;
+    /// Called when the indexed layer failed to provide a file. If that layer does not have the
+    /// file at all (i.e. another path has the same hash), returns the topmost lower layer that
+    /// has it. Otherwise, or if there is no such layer, returns -1.
+    s32 resolveCollision_(const SafeString& path, s32 layer);
+    FileDevice* findHandleLayer_(const HandleBase* handle) const;
+    bool insertIndex_(u32 hash, s32 layer);
+    bool indexLayer_(s32 layer, const SafeString& dir, s32 depth);
+    bool rebuildIndex_();
+
+    Buffer<FileDevice*> mLayers;
+    s32 mNumLayers = 0;
+    Buffer<IndexEntry> mIndex;
+    s32 mNumIndexed = 0;
+};
+}  // namespace sead
@@ -10,6 +10,10 @@ class Path
 public:
     static bool getDriveName(BufferedSafeString* drive_name, const SafeString& path);
     static void getPathExceptDrive(BufferedSafeString* out, const SafeString& path);
+    /// Same as getPathExceptDrive, but returns a view into `path` instead of copying.
+    static SafeString getPathExceptDrive(const SafeString& path);
+    /// @returns the length of the drive name, or -1 if the path has no drive name
+    static s32 getDriveNameLength(const SafeString& path);
     static bool getExt(BufferedSafeString* ext, const SafeString& path);
     static bool getFileName(BufferedSafeString* name, const SafeString& path);
     static bool getBaseFileName(BufferedSafeString* name, const SafeString& path);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <math/seadMathCalcCommon.h>
+#include <math/seadMathSimd.h>
+
+namespace sead
+{
+// Structure-of-arrays views of bounding volumes for the batched intersection tests
+// (Frustum::cullSpheres, RayCast::intersectBoxes, ...). Every member points to a stream holding
+// one component for all volumes; streams are not required to be aligned.
+
+struct SphereStream
+{
+    const f32* x;
+    const f32* y;
+    const f32* z;
+    const f32* radius;
+};
+
+/// Axis-aligned boxes, stored as min and max corners like BoundBox3.
+struct BoxStream
+{
+    const f32* min_x;
+    const f32* min_y;
+    const f32* min_z;
+    const f32* max_x;
+    const f32* max_y;
+    const f32* max_z;
+};
+
+/// Oriented boxes, each given by the transformation that maps the cube [-1, 1]^3 onto the box:
+/// columns 0-2 are the box axes scaled by the half extents and column 3 is the center.
+/// m[row][column] points to the stream of that matrix element, which is the layout of
+/// Matrix34SoA::m.
+struct OrientedBoxStream
+{
+    const f32* m[3][4];
+};
+
+/// Batched tests write their results as bitmasks: bit (i % 32) of word (i / 32) is set if the
+/// test passed for volume i. Unused bits of the last word are cleared.
+class CullMask
+{
+public:
+    static constexpr s32 cBitsPerWord = 32;
+
+    /// Number of words needed to store the results for `num` volumes.
+    static constexpr s32 calcWordNum(s32 num) { return (num + cBitsPerWord - 1) / cBitsPerWord; }
+    static bool isSet(const u32* mask, s32 i) { return ((mask[i / 32] >> (i % 32)) & 1) != 0; }
+
+    /// Runs a test over `num` volumes and writes the results to `mask`. `Test` provides
+    /// `bool test(s32 i) const` and, if SEAD_MATH_SIMD is defined, `detail::F32x4 test4(s32 i)
+    /// const`, which tests volumes i to i + 3 and returns a lane mask. Both must give the same
+    /// results.
+    template <typename Test>
+    static void build(u32* mask, s32 num, const Test& test);
+};
+
+template <typename Test>
+inline void CullMask::build(u32* mask, s32 num, const Test& test)
+{
+    for (s32 base = 0; base < num; base += cBitsPerWord)
+    {
+        const s32 end = Mathi::min(base + cBitsPerWord, num);
+        u32 word = 0;
+        s32 i = base;
+#ifdef SEAD_MATH_SIMD
+        for (; i + 4 <= end; i += 4)
+            word |= detail::simdMoveMask(test.test4(i)) << (i - base);
+#endif
+        for (; i < end; ++i)
+            word |= static_cast<u32>(test.test(i)) << (i - base);
+
+        mask[base / cBitsPerWord] = word;
+    }
+}
+
+}  // namespace sead
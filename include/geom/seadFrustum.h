@@ -0,0 +1,73 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <geom/seadBoundVolumeStream.h>
+#include <math/seadBoundBox.h>
+#include <math/seadMatrix.h>
+#include <math/seadVector.h>
+
+namespace sead
+{
+class Camera;
+class Projection;
+
+/// A convex volume bounded by six planes, usually the view volume of a camera.
+///
+/// Planes are stored as (a, b, c, d) where the normal (a, b, c) is normalized and points
+/// inwards: a point p is on the inner side of a plane if a * p.x + b * p.y + c * p.z + d >= 0.
+///
+/// The volume tests are conservative. A volume is only rejected if it lies completely outside
+/// one of the planes, so volumes close to the edges of the frustum may be reported as
+/// intersecting even though they are outside.
+class Frustum
+{
+public:
+    enum Plane
+    {
+        cPlane_Left,
+        cPlane_Right,
+        cPlane_Bottom,
+        cPlane_Top,
+        cPlane_Near,
+        cPlane_Far,
+        cPlane_Num
+    };
+
+    Frustum() = default;
+
+    /// Extracts the view volume of `camera` with `projection`, in world space.
+    void set(const Camera& camera, const Projection& projection);
+    /// Extracts the planes from a matrix that transforms to clip space, where the view volume is
+    /// -w <= x, y, z <= w (the convention of Projection::getProjectionMatrix). The planes are in
+    /// the source space of the matrix: camera space for a projection matrix, world space for a
+    /// view-projection matrix.
+    void set(const Matrix44f& clip_mtx);
+    /// Sets a plane. The normal does not need to be normalized.
+    void setPlane(Plane index, const Vector4f& plane);
+
+    const Vector4f& getPlane(Plane index) const { return mPlanes[index]; }
+
+    bool isInside(const Vector3f& p) const;
+    bool isIntersectSphere(const Vector3f& center, f32 radius) const;
+    bool isIntersectBox(const BoundBox3f& box) const;
+    /// `box` maps the cube [-1, 1]^3 onto the box (see OrientedBoxStream).
+    bool isIntersectOrientedBox(const Matrix34f& box) const;
+
+    // Batched versions of the tests above. `mask` must hold CullMask::calcWordNum(num) words;
+    // the bit of a volume is set if it intersects the frustum.
+
+    void cullSpheres(u32* mask, const SphereStream& spheres, s32 num) const;
+    void cullBoxes(u32* mask, const BoxStream& boxes, s32 num) const;
+    void cullOrientedBoxes(u32* mask, const OrientedBoxStream& boxes, s32 num) const;
+
+private:
+    f32 calcDistance_(Plane index, f32 x, f32 y, f32 z) const
+    {
+        const Vector4f& p = mPlanes[index];
+        return p.x * x + p.y * y + p.z * z + p.w;
+    }
+
+    Vector4f mPlanes[cPlane_Num];
+};
+
+}  // namespace sead
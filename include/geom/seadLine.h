@@ -0,0 +1,32 @@
+#pragma once
+
+#include <math/seadVector.h>
+
+namespace sead
+{
+/// A half-line starting at a position and extending in a direction. The direction does not need
+/// to be normalized; distances along the ray are then expressed in multiples of its length.
+template <typename T>
+class Ray
+{
+public:
+    Ray() = default;
+    Ray(const T& pos, const T& dir) : mPos(pos), mDir(dir) {}
+
+    const T& getPos() const { return mPos; }
+    const T& getDir() const { return mDir; }
+
+    void set(const T& pos, const T& dir)
+    {
+        mPos = pos;
+        mDir = dir;
+    }
+    void setPos(const T& pos) { mPos = pos; }
+    void setDir(const T& dir) { mDir = dir; }
+
+private:
+    T mPos;
+    T mDir;
+};
+
+}  // namespace sead
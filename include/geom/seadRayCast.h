@@ -0,0 +1,30 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <geom/seadBoundVolumeStream.h>
+#include <geom/seadLine.h>
+#include <math/seadBoundBox.h>
+#include <math/seadMathCalcCommon.h>
+#include <math/seadVector.h>
+
+namespace sead
+{
+/// Ray intersection tests against bounding volumes.
+///
+/// Distances are measured along the ray in multiples of the length of its direction.
+/// A ray that starts inside a volume hits it at distance 0.
+class RayCast
+{
+public:
+    /// Returns whether `ray` hits `box` at a distance in [0, max_dist]. On a hit, the entry
+    /// distance is written to `t` if it is not null.
+    static bool intersectBox(f32* t, const Ray<Vector3f>& ray, const BoundBox3f& box,
+                             f32 max_dist = Mathf::maxNumber());
+
+    /// Batched version of intersectBox. `mask` must hold CullMask::calcWordNum(num) words;
+    /// the bit of a box is set if the ray hits it at a distance in [0, max_dist].
+    static void intersectBoxes(u32* mask, const Ray<Vector3f>& ray, const BoxStream& boxes,
+                               s32 num, f32 max_dist = Mathf::maxNumber());
+};
+
+}  // namespace sead
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <container/seadBuffer.h>
+#include <container/seadSafeArray.h>
+#include <geom/seadLine.h>
+#include <math/seadBoundBox.h>
+#include <math/seadMathCalcCommon.h>
+#include <math/seadVector.h>
+#include <mc/seadCoreInfo.h>
+#include <mc/seadJob.h>
+#include <mc/seadJobQueue.h>
+
+namespace sead
+{
+class Frustum;
+class Heap;
+class WorkerMgr;
+
+/// Bounding volume hierarchy over a set of axis-aligned boxes ("primitives"), for broad-phase
+/// ray, overlap and nearest queries.
+///
+/// The tree is built top-down with a binned surface area heuristic. Nodes are stored in a flat
+/// array in depth-first order and the two children of a node are adjacent, so that a node pair
+/// fills exactly one 64-byte cache line. Primitive boxes are kept in leaf order, which makes leaf
+/// tests linear reads as well.
+///
+/// Moving primitives are handled by updating their boxes with setBox and calling refit, which
+/// recomputes the node bounds without changing the topology. Rebuild the tree if the primitives
+/// have moved so much that the queries become slow.
+///
+/// Primitives are identified by their index in the array that was passed to build.
+class Bvh
+{
+public:
+    struct Node
+    {
+        bool isLeaf() const { return count != 0; }
+
+        Vector3f min;
+        /// Leaf: index of the first primitive slot. Inner node: index of the first child; the
+        /// second child is at offset + 1.
+        s32 offset;
+        Vector3f max;
+        /// Number of primitives in a leaf, 0 for an inner node.
+        s32 count;
+    };
+
+    struct BuildArg
+    {
+        BuildArg();
+
+        /// Nodes with at most this many primitives may become leaves.
+        s32 max_leaf_size;
+        /// If set, the upper levels of the tree are built on the calling thread and the
+        /// subtrees below them are built as jobs on the workers of `core_mask`. build then calls
+        /// WorkerMgr::run and WorkerMgr::sync, so it must be called from the thread that drives
+        /// the worker manager and while no other job queue is pending.
+        WorkerMgr* worker_mgr;
+        CoreIdMask core_mask;
+    };
+
+    Bvh() = default;
+    ~Bvh() { freeBuffer(); }
+    Bvh(const Bvh&) = delete;
+    Bvh& operator=(const Bvh&) = delete;
+
+    void allocBuffer(s32 max_primitives, Heap* heap);
+    bool tryAllocBuffer(s32 max_primitives, Heap* heap);
+    void freeBuffer();
+    bool isBufferReady() const { return mNodes.isBufferReady(); }
+
+    void build(const BoundBox3f* boxes, s32 num, const BuildArg& arg = BuildArg());
+    void clear();
+
+    /// Updates the box of a primitive. The tree is only updated by the next call to refit.
+    void setBox(s32 index, const BoundBox3f& box) { mBoxes[mSlots[index]] = box; }
+    /// Recomputes the bounds of every node from the primitive boxes.
+    void refit();
+    /// Sets the boxes of all primitives, indexed like in build, then refits.
+    void refit(const BoundBox3f* boxes);
+
+    s32 getNumPrimitives() const { return mNumPrimitives; }
+    s32 getNumNodes() const { return mNumNodes; }
+    const Node& getNode(s32 index) const { return mNodes[index]; }
+    const BoundBox3f& getBox(s32 index) const { return mBoxes[mSlots[index]]; }
+
+    // The query functions below write the indices of the primitives that pass to `out`, up to
+    // `out_max` of them, and return the total number of primitives that pass (which can be
+    // larger than `out_max`).
+
+    s32 queryBox(s32* out, s32 out_max, const BoundBox3f& box) const;
+    s32 queryFrustum(s32* out, s32 out_max, const Frustum& frustum) const;
+    /// Primitives whose box is hit by `ray` at a distance in [0, max_dist], roughly from front
+    /// to back.
+    s32 queryRay(s32* out, s32 out_max, const Ray<Vector3f>& ray,
+                 f32 max_dist = Mathf::maxNumber()) const;
+
+    /// Returns the primitive whose box is hit first by `ray` at a distance in [0, max_dist], or
+    /// -1. The distance is written to `t` if it is not null.
+    s32 raycast(f32* t, const Ray<Vector3f>& ray, f32 max_dist = Mathf::maxNumber()) const;
+    /// Returns the primitive whose box is closest to `p` with a squared distance of at most
+    /// `max_dist_sq`, or -1. The squared distance is written to `dist_sq` if it is not null.
+    s32 findNearest(f32* dist_sq, const Vector3f& p,
+                    f32 max_dist_sq = Mathf::maxNumber()) const;
+
+private:
+    class BuildJob : public Job
+    {
+    public:
+        void invoke() override;
+
+        Bvh* bvh;
+        s32 root;
+        s32 begin;
+        s32 end;
+        s32 depth;
+        s32 node_begin;
+        s32 node_end;
+    };
+
+    /// Traversal stacks hold at most one entry per level.
+    static constexpr s32 cDepthMax = 60;
+    static constexpr s32 cStackSize = cDepthMax + 4;
+    static constexpr s32 cBinNum = 16;
+    static constexpr s32 cParallelTaskMax = 16;
+    /// Subtrees smaller than this are not split further to create parallel tasks.
+    static constexpr s32 cParallelTaskMinSize = 1024;
+
+    static s32 calcNodeNumMax_(s32 max_primitives);
+    /// Total size of the allocations of tryAllocBuffer, for AllocFailAssert.
+    static size_t calcBufferSize_(s32 max_primitives);
+
+    bool splitNode_(s32 node, s32 begin, s32 end, s32 depth, s32* mid);
+    s32 buildSubtree_(s32 root, s32 begin, s32 end, s32 depth, s32 node_begin);
+    void buildParallel_(WorkerMgr* worker_mgr, CoreIdMask core_mask);
+    void setNodeBounds_(s32 node, s32 begin, s32 end);
+
+    Buffer<Node> mNodes;
+    /// Primitive index of every slot, in leaf order.
+    Buffer<s32> mIndices;
+    /// Slot of every primitive.
+    Buffer<s32> mSlots;
+    /// Box of every slot.
+    Buffer<BoundBox3f> mBoxes;
+    /// Box centers during the build, indexed by primitive.
+    Buffer<Vector3f> mCenters;
+    const BoundBox3f* mBuildBoxes = nullptr;
+    s32 mMaxLeafSize = 4;
+    s32 mNumPrimitives = 0;
+    s32 mNumNodes = 0;
+
+    FixedSizeJQ mBuildQueue;
+    SafeArray<BuildJob, cParallelTaskMax> mBuildJobs;
+};
+
+}  // namespace sead
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <math/seadQuat.h>
+
+namespace sead
+{
+// Unit quaternions compressed with the "smallest three" encoding, for animation tracks and
+// network replication.
+//
+// The component with the largest magnitude is dropped and recomputed from the other three on
+// decode; its index is stored in 2 bits. Because q and -q are the same rotation, the quaternion
+// is negated if needed so that the dropped component is positive. The magnitude of the three
+// remaining components is at most 1/sqrt(2), so they are quantized over [-1/sqrt(2), 1/sqrt(2)]
+// only. The quantization keeps an odd number of levels so that 0 is represented exactly.
+//
+// The input must be normalized. Decoded quaternions are unit length up to rounding errors.
+// Both encoders round to the nearest level. The maximum errors below are per component and
+// include the error of the recomputed component.
+
+/// 3 x 15 bits: max error 5.3e-5 (an angle error below 0.01 degrees).
+struct CompressedQuat48
+{
+    void encode(const Quatf& q);
+    void decode(Quatf* q) const;
+
+    static void encode(CompressedQuat48* out, const Quatf* q, s32 n);
+    /// The loop is free of branches and calls so that it can be vectorized.
+    static void decode(Quatf* out, const CompressedQuat48* in, s32 n);
+
+    /// Index of the dropped component in bits 45-46, then the three others in x, y, z, w order
+    /// from bit 30 down to bit 0. Stored as 16-bit words, most significant first, so that the
+    /// layout does not depend on the endianness and the struct needs no padding.
+    u16 data[3];
+};
+static_assert(sizeof(CompressedQuat48) == 6);
+
+/// 3 x 10 bits: max error 1.8e-3 (an angle error below 0.25 degrees).
+struct CompressedQuat32
+{
+    void encode(const Quatf& q);
+    void decode(Quatf* q) const;
+
+    static void encode(CompressedQuat32* out, const Quatf* q, s32 n);
+    /// The loop is free of branches and calls so that it can be vectorized.
+    static void decode(Quatf* out, const CompressedQuat32* in, s32 n);
+
+    /// Index of the dropped component in bits 30-31, then the three others in x, y, z, w order
+    /// from bit 20 down to bit 0.
+    u32 data;
+};
+static_assert(sizeof(CompressedQuat32) == 4);
+
+}  // namespace sead
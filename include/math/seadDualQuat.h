@@ -0,0 +1,73 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <math/seadMatrix.h>
+#include <math/seadQuat.h>
+#include <math/seadVector.h>
+
+namespace sead
+{
+/// Unit dual quaternion: a rigid transformation (rotation then translation).
+///
+/// Unlike matrices, dual quaternions can be blended without introducing scale or shear, which
+/// makes them the usual choice for skinning: blend() implements dual quaternion linear blending
+/// (DLB), which avoids the volume loss of linear blend skinning around twisting joints.
+template <typename T>
+struct DualQuat
+{
+private:
+    using QuatT = Quat<T>;
+    using Vec3 = Vector3<T>;
+    using Mtx34 = Matrix34<T>;
+
+public:
+    DualQuat() {}
+    constexpr DualQuat(const QuatT& real_, const QuatT& dual_) : real(real_), dual(dual_) {}
+    /// `r` must be normalized.
+    DualQuat(const QuatT& r, const Vec3& t) { setRotationTranslation(r, t); }
+
+    void makeUnit();
+    /// `r` must be normalized.
+    void setRotationTranslation(const QuatT& r, const Vec3& t);
+    void setMatrix(const Mtx34& m);
+    /// Concatenation: the result applies `b` first, then `a`.
+    void setMul(const DualQuat& a, const DualQuat& b);
+    /// Inverse of a unit dual quaternion.
+    void setInverse(const DualQuat& dq);
+    /// Makes the real part unit length and the dual part orthogonal to it, which is required
+    /// after blending or after accumulating many products. Returns the previous length of the
+    /// real part; a zero dual quaternion is left unchanged.
+    T normalize();
+
+    void getTranslation(Vec3& t) const;
+    Vec3 getTranslation() const;
+    void toMatrix(Mtx34& m) const;
+
+    /// Rotates and translates a point.
+    void transformPoint(Vec3& o, const Vec3& p) const;
+    /// Rotates a direction (the translation is ignored).
+    void rotate(Vec3& o, const Vec3& v) const;
+    /// Transforms `n` points. `out` may be the same array as `p`.
+    void transformPoints(Vec3* out, const Vec3* p, s32 n) const;
+
+    /// Dual quaternion linear blending of `n` unit dual quaternions, for example the bones
+    /// influencing a vertex. The weights do not need to sum to 1. Every input is flipped to the
+    /// hemisphere of the first one, so that the blend follows the shorter path.
+    static void blend(DualQuat& out, const DualQuat* dqs, const T* weights, s32 n);
+
+    QuatT real;
+    QuatT dual;
+
+    static const DualQuat unit;
+};
+
+using DualQuatf = DualQuat<f32>;
+
+template <>
+const DualQuatf DualQuatf::unit;
+
+}  // namespace sead
+
+#define SEAD_MATH_DUAL_QUAT_H_
+#include <math/seadDualQuat.hpp>
+#undef SEAD_MATH_DUAL_QUAT_H_
@@ -0,0 +1,151 @@
+#pragma once
+
+#ifndef SEAD_MATH_DUAL_QUAT_H_
+#include <math/seadDualQuat.h>
+#endif
+
+namespace sead
+{
+template <typename T>
+inline void DualQuat<T>::makeUnit()
+{
+    real.makeUnit();
+    dual.set(0, 0, 0, 0);
+}
+
+template <typename T>
+inline void DualQuat<T>::setRotationTranslation(const QuatT& r, const Vec3& t)
+{
+    // dual = 0.5 * (0, t) * r
+    real = r;
+    dual.w = T(-0.5) * (t.x * r.x + t.y * r.y + t.z * r.z);
+    dual.x = T(0.5) * (t.x * r.w + t.y * r.z - t.z * r.y);
+    dual.y = T(0.5) * (-t.x * r.z + t.y * r.w + t.z * r.x);
+    dual.z = T(0.5) * (t.x * r.y - t.y * r.x + t.z * r.w);
+}
+
+template <typename T>
+inline void DualQuat<T>::setMatrix(const Mtx34& m)
+{
+    QuatT r;
+    m.toQuat(r);
+    r.normalize();
+    setRotationTranslation(r, m.getTranslation());
+}
+
+template <typename T>
+inline void DualQuat<T>::setMul(const DualQuat& a, const DualQuat& b)
+{
+    QuatT r, d;
+    r.setMul(a.real, b.real);
+    d.setMul(a.real, b.dual);
+    d += a.dual * b.real;
+    real = r;
+    dual = d;
+}
+
+template <typename T>
+inline void DualQuat<T>::setInverse(const DualQuat& dq)
+{
+    // The conjugate in both the quaternion and the dual sense.
+    real.set(dq.real.w, -dq.real.x, -dq.real.y, -dq.real.z);
+    dual.set(dq.dual.w, -dq.dual.x, -dq.dual.y, -dq.dual.z);
+}
+
+template <typename T>
+inline T DualQuat<T>::normalize()
+{
+    const T len = real.length();
+    if (len > 0)
+    {
+        const T inv_len = 1 / len;
+        real *= inv_len;
+        dual *= inv_len;
+        dual -= real * real.dot(dual);
+    }
+    return len;
+}
+
+template <typename T>
+inline void DualQuat<T>::getTranslation(Vec3& t) const
+{
+    // Vector part of 2 * dual * conjugate(real)
+    t.x = 2 * (real.w * dual.x - dual.w * real.x + real.y * dual.z - real.z * dual.y);
+    t.y = 2 * (real.w * dual.y - dual.w * real.y + real.z * dual.x - real.x * dual.z);
+    t.z = 2 * (real.w * dual.z - dual.w * real.z + real.x * dual.y - real.y * dual.x);
+}
+
+template <typename T>
+inline Vector3<T> DualQuat<T>::getTranslation() const
+{
+    Vec3 t;
+    getTranslation(t);
+    return t;
+}
+
+template <typename T>
+inline void DualQuat<T>::toMatrix(Mtx34& m) const
+{
+    m.makeQT(real, getTranslation());
+}
+
+template <typename T>
+inline void DualQuat<T>::rotate(Vec3& o, const Vec3& v) const
+{
+    // v + 2 * r x (r x v + w * v), with r the vector part of the real quaternion
+    const T cx = real.y * v.z - real.z * v.y + real.w * v.x;
+    const T cy = real.z * v.x - real.x * v.z + real.w * v.y;
+    const T cz = real.x * v.y - real.y * v.x + real.w * v.z;
+    const T x = v.x + 2 * (real.y * cz - real.z * cy);
+    const T y = v.y + 2 * (real.z * cx - real.x * cz);
+    const T z = v.z + 2 * (real.x * cy - real.y * cx);
+    o.set(x, y, z);
+}
+
+template <typename T>
+inline void DualQuat<T>::transformPoint(Vec3& o, const Vec3& p) const
+{
+    Vec3 t;
+    getTranslation(t);
+    rotate(o, p);
+    o += t;
+}
+
+template <typename T>
+void DualQuat<T>::transformPoints(Vec3* out, const Vec3* p, s32 n) const
+{
+    Vec3 t;
+    getTranslation(t);
+    for (s32 i = 0; i < n; ++i)
+    {
+        Vec3 v;
+        rotate(v, p[i]);
+        out[i].set(v.x + t.x, v.y + t.y, v.z + t.z);
+    }
+}
+
+template <typename T>
+void DualQuat<T>::blend(DualQuat& out, const DualQuat* dqs, const T* weights, s32 n)
+{
+    if (n <= 0)
+    {
+        out.makeUnit();
+        return;
+    }
+
+    const QuatT& pivot = dqs[0].real;
+    QuatT r(0, 0, 0, 0);
+    QuatT d(0, 0, 0, 0);
+    for (s32 i = 0; i < n; ++i)
+    {
+        const T w = pivot.dot(dqs[i].real) < 0 ? -weights[i] : weights[i];
+        r += dqs[i].real * w;
+        d += dqs[i].dual * w;
+    }
+
+    out.real = r;
+    out.dual = d;
+    out.normalize();
+}
+
+}  // namespace sead
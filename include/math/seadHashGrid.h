@@ -0,0 +1,119 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <container/seadBuffer.h>
+#include <container/seadSafeArray.h>
+#include <math/seadBoundBox.h>
+#include <math/seadVector.h>
+#include <mc/seadCoreInfo.h>
+#include <mc/seadJob.h>
+#include <mc/seadJobQueue.h>
+
+namespace sead
+{
+class Heap;
+class WorkerMgr;
+
+/// Uniform grid of cubic cells over an unbounded space, for neighbourhood queries on points that
+/// move every frame.
+///
+/// Cells are hashed into a fixed number of buckets, so memory does not depend on the extent of
+/// the space. build sorts the points by bucket with a counting sort: it runs in O(n + buckets),
+/// and it allocates nothing, so the buffers can live on a FrameHeap that is reset with the frame.
+/// The points of a bucket are stored contiguously together with their positions, which keeps
+/// queries cache friendly.
+///
+/// Points are identified by their index in the array that was passed to build. Objects with an
+/// extent can be queried by enlarging the query by the largest object radius.
+class HashGrid
+{
+public:
+    struct BuildArg
+    {
+        BuildArg();
+
+        /// If set, the cells of the points are computed by jobs on the workers of `core_mask`.
+        /// build then calls WorkerMgr::run and WorkerMgr::sync, so it must be called from the
+        /// thread that drives the worker manager and while no other job queue is pending.
+        WorkerMgr* worker_mgr;
+        CoreIdMask core_mask;
+    };
+
+    HashGrid() = default;
+    ~HashGrid() { freeBuffer(); }
+    HashGrid(const HashGrid&) = delete;
+    HashGrid& operator=(const HashGrid&) = delete;
+
+    /// `bucket_num` is rounded up to a power of 2. If it is 0, twice `max_points` is used.
+    void allocBuffer(s32 max_points, Heap* heap, s32 bucket_num = 0);
+    bool tryAllocBuffer(s32 max_points, Heap* heap, s32 bucket_num = 0);
+    void freeBuffer();
+    bool isBufferReady() const { return mBucketStarts.isBufferReady(); }
+
+    /// `positions` divided by `cell_size` must be within the range of s32.
+    void build(const Vector3f* positions, s32 num, f32 cell_size,
+               const BuildArg& arg = BuildArg());
+    void clear();
+
+    s32 getNumPoints() const { return mNumPoints; }
+    f32 getCellSize() const { return mCellSize; }
+    void calcCell(Vector3i* cell, const Vector3f& pos) const;
+
+    // The query functions below write the indices of the points that pass to `out`, up to
+    // `out_max` of them, and return the total number of points that pass (which can be larger
+    // than `out_max`).
+
+    s32 queryRadius(s32* out, s32 out_max, const Vector3f& center, f32 radius) const;
+    s32 queryBox(s32* out, s32 out_max, const BoundBox3f& box) const;
+
+private:
+    class BuildJob : public Job
+    {
+    public:
+        void invoke() override;
+
+        HashGrid* grid;
+        const Vector3f* positions;
+        s32 begin;
+        s32 end;
+    };
+
+    static constexpr s32 cParallelTaskMax = 16;
+    /// Point ranges smaller than this are not worth a job.
+    static constexpr s32 cParallelTaskMinSize = 2048;
+
+    static s32 calcBucketNum_(s32 max_points, s32 bucket_num);
+    /// Total size of the allocations of tryAllocBuffer, for AllocFailAssert.
+    static size_t calcBufferSize_(s32 max_points, s32 bucket_num);
+
+    static u32 calcHash_(const Vector3i& cell)
+    {
+        return (static_cast<u32>(cell.x) * 73856093u) ^ (static_cast<u32>(cell.y) * 19349663u) ^
+               (static_cast<u32>(cell.z) * 83492791u);
+    }
+
+    void calcCells_(const Vector3f* positions, s32 begin, s32 end);
+
+    template <typename Test>
+    s32 query_(s32* out, s32 out_max, const Vector3i& min, const Vector3i& max,
+               const Test& test) const;
+
+    /// Index of the first sorted point of every bucket, plus the total at the end.
+    Buffer<s32> mBucketStarts;
+    /// Sorted by bucket: point index, position and cell.
+    Buffer<s32> mIndices;
+    Buffer<Vector3f> mPositions;
+    Buffer<Vector3i> mCells;
+    /// Indexed by point: cell and bucket, computed before sorting.
+    Buffer<Vector3i> mPointCells;
+    Buffer<s32> mPointBuckets;
+    u32 mBucketMask = 0;
+    s32 mNumPoints = 0;
+    f32 mCellSize = 1.0f;
+    f32 mInvCellSize = 1.0f;
+
+    FixedSizeJQ mBuildQueue;
+    SafeArray<BuildJob, cParallelTaskMax> mBuildJobs;
+};
+
+}  // namespace sead
@@ -41,23 +41,23 @@ public:
         T log_delta;
     };
 
-    static T piHalf() { return numbers::pi_v<T> / static_cast<T>(2); }
-    static T pi() { return numbers::pi_v<T>; }
-    static T pi2() { return numbers::pi_v<T> * static_cast<T>(2); }
-    static T zero() { return static_cast<T>(0); }
-    static T one() { return static_cast<T>(1); }
-    static T ln2() { return numbers::ln2_v<T>; }
-    static T ln2Inv() { return numbers::log2e_v<T>; }
+    static constexpr T piHalf() { return numbers::pi_v<T> / static_cast<T>(2); }
+    static constexpr T pi() { return numbers::pi_v<T>; }
+    static constexpr T pi2() { return numbers::pi_v<T> * static_cast<T>(2); }
+    static constexpr T zero() { return static_cast<T>(0); }
+    static constexpr T one() { return static_cast<T>(1); }
+    static constexpr T ln2() { return numbers::ln2_v<T>; }
+    static constexpr T ln2Inv() { return numbers::log2e_v<T>; }
 
     static T neg(T t);
     static T inv(T t);
 
     /// Returns -1 for strictly negative values and 1 otherwise.
-    static T sign(T value);
+    static constexpr T sign(T value);
 
-    static T fitSign(T value, T sign_value) { return abs(value) * sign(sign_value); }
+    static constexpr T fitSign(T value, T sign_value) { return abs(value) * sign(sign_value); }
 
-    static T square(T t) { return t * t; }
+    static constexpr T square(T t) { return t * t; }
 
     static T sqrt(T t);
     static T rsqrt(T t);
@@ -97,23 +97,23 @@ public:
     static T maxNumber();
     static T infinity();
     static T nan();
-    static T epsilon() { return std::numeric_limits<T>::epsilon(); }
+    static constexpr T epsilon() { return std::numeric_limits<T>::epsilon(); }
 
-    static bool equalsEpsilon(T lhs, T rhs, T eps = epsilon())
+    static constexpr bool equalsEpsilon(T lhs, T rhs, T eps = epsilon())
     {
         const T diff = lhs - rhs;
         return -eps <= diff && diff <= eps;
     }
 
-    static T abs(T x) { return x > 0 ? x : -x; }
+    static constexpr T abs(T x) { return x > 0 ? x : -x; }
 
-    static T max(T a, T b);
-    static T min(T a, T b);
-    static T max3(T a, T b, T c);
-    static T min3(T a, T b, T c);
+    static constexpr T max(T a, T b);
+    static constexpr T min(T a, T b);
+    static constexpr T max3(T a, T b, T c);
+    static constexpr T min3(T a, T b, T c);
 
-    static T deg2rad(T deg);
-    static T rad2deg(T rad);
+    static constexpr T deg2rad(T deg);
+    static constexpr T rad2deg(T rad);
 
     static u32 deg2idx(T a);
     static u32 rad2idx(T a);
@@ -134,11 +134,11 @@ public:
     static s32 roundUpPow2(T x, u32 y);
     static s32 roundDownN(T val, u32 multNumber);
     static s32 roundDownPow2(T x, u32 y);
-    static T clampMax(T val, T max_);
-    static T clampMin(T val, T min_);
-    static T clamp(T value, T low, T high);
+    static constexpr T clampMax(T val, T max_);
+    static constexpr T clampMin(T val, T min_);
+    static constexpr T clamp(T value, T low, T high);
     // This is the same as clamp, but with a different order for arguments.
-    static T clamp2(T min_, T val, T max_);
+    static constexpr T clamp2(T min_, T val, T max_);
     static T gcd(T x, T y);
     static T lcm(T x, T y);
     static bool isZero(T, T);
@@ -23,7 +23,7 @@ template <>
 const MathCalcCommon<float>::LogSample MathCalcCommon<float>::cLogTbl[];
 
 template <typename T>
-inline T MathCalcCommon<T>::sign(T value)
+constexpr T MathCalcCommon<T>::sign(T value)
 {
     return value < 0 ? -1 : 1;
 }
@@ -339,13 +339,13 @@ inline f64 MathCalcCommon<f64>::nan()
 }
 
 template <>
-inline s32 MathCalcCommon<s32>::abs(s32 x)
+constexpr s32 MathCalcCommon<s32>::abs(s32 x)
 {
     return (x ^ x >> 31) - (x >> 31);
 }
 
 template <>
-inline u32 MathCalcCommon<u32>::abs(u32 x)
+constexpr u32 MathCalcCommon<u32>::abs(u32 x)
 {
     return x;
 }
@@ -367,37 +367,37 @@ inline f64 MathCalcCommon<f64>::abs(f64 x)
 #endif  // cafe
 
 template <typename T>
-inline T MathCalcCommon<T>::max(T a, T b)
+constexpr T MathCalcCommon<T>::max(T a, T b)
 {
     return a > b ? a : b;
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::min(T a, T b)
+constexpr T MathCalcCommon<T>::min(T a, T b)
 {
     return a < b ? a : b;
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::max3(T a, T b, T c)
+constexpr T MathCalcCommon<T>::max3(T a, T b, T c)
 {
     return max(max(a, b), c);
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::min3(T a, T b, T c)
+constexpr T MathCalcCommon<T>::min3(T a, T b, T c)
 {
     return min(min(a, b), c);
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::deg2rad(T deg)
+constexpr T MathCalcCommon<T>::deg2rad(T deg)
 {
     return deg * (numbers::pi_v<T> / static_cast<T>(180));
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::rad2deg(T rad)
+constexpr T MathCalcCommon<T>::rad2deg(T rad)
 {
     return rad * (static_cast<T>(180) / numbers::pi_v<T>);
 }
@@ -501,25 +501,25 @@ inline s32 MathCalcCommon<s32>::roundUpPow2(s32 val, u32 base)
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::clampMax(T val, T max_)
+constexpr T MathCalcCommon<T>::clampMax(T val, T max_)
 {
     return val > max_ ? max_ : val;
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::clampMin(T val, T min_)
+constexpr T MathCalcCommon<T>::clampMin(T val, T min_)
 {
     return val < min_ ? min_ : val;
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::clamp2(T min_, T val, T max_)
+constexpr T MathCalcCommon<T>::clamp2(T min_, T val, T max_)
 {
     return clamp(val, min_, max_);
 }
 
 template <typename T>
-inline T MathCalcCommon<T>::clamp(T value, T low, T high)
+constexpr T MathCalcCommon<T>::clamp(T value, T low, T high)
 {
     if (value < low)
         value = low;
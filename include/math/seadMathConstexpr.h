@@ -0,0 +1,213 @@
+#pragma once
+
+#include <array>
+#include <basis/seadTypes.h>
+#include <math/seadMathCalcCommon.h>
+
+namespace sead
+{
+/// Math functions that can be evaluated at compile time, for building constant tables and
+/// transforms: the <cmath> functions are not constexpr.
+///
+/// Everything is computed in double precision with plain series, so these are slow. Use
+/// MathCalcCommon or MathFastCalc for values that are only known at runtime.
+class MathConstexpr
+{
+public:
+    /// Max absolute error: 4e-16 for |x| <= 100. It grows with |x| beyond that.
+    static constexpr f64 sin(f64 x)
+    {
+        f64 s = 0, c = 0;
+        sinCos(&s, &c, x);
+        return s;
+    }
+
+    static constexpr f64 cos(f64 x)
+    {
+        f64 s = 0, c = 0;
+        sinCos(&s, &c, x);
+        return c;
+    }
+
+    static constexpr void sinCos(f64* p_sin, f64* p_cos, f64 x)
+    {
+        // x = r + k * pi/2 with |r| <= pi/4 (Cody-Waite with a 2-part pi/2)
+        const f64 kf = x * 0.63661977236758134308;
+        const s64 k = static_cast<s64>(kf < 0 ? kf - 0.5 : kf + 0.5);
+        const f64 r = (x - static_cast<f64>(k) * 1.5707963267341256) -
+                      static_cast<f64>(k) * 6.077100506506192e-11;
+        setQuadrant_(p_sin, p_cos, sinSeries_(r), cosSeries_(r), k);
+    }
+
+    /// sin and cos of `num / den` turns (2 * pi * num / den radians). The angle is reduced with
+    /// integer arithmetic, so the results are exact at multiples of a quarter turn and have the
+    /// same symmetries as the real functions.
+    static constexpr void sinCosTurn(f64* p_sin, f64* p_cos, s64 num, s64 den)
+    {
+        // num / den = k / 4 + rem / (4 * den) with 0 <= rem < den
+        s64 k = (4 * num) / den;
+        s64 rem = 4 * num - k * den;
+        if (rem < 0)
+        {
+            rem += den;
+            --k;
+        }
+        // Use the next quadrant for the upper half so that |r| <= pi/4.
+        if (2 * rem > den)
+        {
+            rem -= den;
+            ++k;
+        }
+        const f64 r = numbers::pi / 2 * static_cast<f64>(rem) / static_cast<f64>(den);
+        setQuadrant_(p_sin, p_cos, sinSeries_(r), cosSeries_(r), k);
+    }
+
+    /// Returns 0 for x <= 0.
+    static constexpr f64 sqrt(f64 x)
+    {
+        if (!(x > 0))
+            return 0;
+
+        // Scale into [1, 4) so that a fixed number of Newton iterations converges.
+        f64 scale = 1;
+        while (x >= 4)
+        {
+            x *= 0.25;
+            scale *= 2;
+        }
+        while (x < 1)
+        {
+            x *= 4;
+            scale *= 0.5;
+        }
+
+        f64 y = (x + 1) * 0.5;
+        for (s32 i = 0; i < 6; ++i)
+            y = 0.5 * (y + x / y);
+        return y * scale;
+    }
+
+private:
+    /// Taylor series for |r| <= pi/4. The last term is below 2^-60.
+    static constexpr f64 sinSeries_(f64 r)
+    {
+        const f64 z = r * r;
+        f64 sum = 0;
+        f64 term = r;
+        for (s32 i = 1; i < 24; i += 2)
+        {
+            sum += term;
+            term *= -z / ((i + 1) * (i + 2));
+        }
+        return sum;
+    }
+
+    static constexpr f64 cosSeries_(f64 r)
+    {
+        const f64 z = r * r;
+        f64 sum = 0;
+        f64 term = 1;
+        for (s32 i = 0; i < 24; i += 2)
+        {
+            sum += term;
+            term *= -z / ((i + 1) * (i + 2));
+        }
+        return sum;
+    }
+
+    /// sin and cos of r + k * pi/2
+    static constexpr void setQuadrant_(f64* p_sin, f64* p_cos, f64 s, f64 c, s64 k)
+    {
+        // 0.0 - x rather than -x so that the zeros are +0.
+        switch (k & 3)
+        {
+        case 0:
+            *p_sin = s;
+            *p_cos = c;
+            break;
+        case 1:
+            *p_sin = c;
+            *p_cos = 0.0 - s;
+            break;
+        case 2:
+            *p_sin = 0.0 - s;
+            *p_cos = 0.0 - c;
+            break;
+        default:
+            *p_sin = 0.0 - c;
+            *p_cos = s;
+            break;
+        }
+    }
+};
+
+/// Sine and cosine table over a full turn with N intervals, generated at compile time.
+///
+/// The samples have the layout of MathCalcCommon<T>::cSinCosTbl (value and delta to the next
+/// sample), and the lookups interpolate in the same way as MathCalcCommon<T>::sinIdx, so a table
+/// with a different resolution can be swapped in where the precision or cache footprint of the
+/// built-in 256-interval table does not fit. SinCosTable<f32, 256> reproduces cSinCosTbl bit for
+/// bit.
+///
+/// Declare tables constexpr so that they are built by the compiler:
+///     static constexpr SinCosTable<f32, 1024> cTable;
+template <typename T, s32 N>
+class SinCosTable
+{
+    static_assert(N >= 4 && (N & (N - 1)) == 0, "N must be a power of 2");
+
+public:
+    using Sample = typename MathCalcCommon<T>::SinCosSample;
+
+    constexpr SinCosTable() : mSamples()
+    {
+        f64 s0 = 0, c0 = 0;
+        MathConstexpr::sinCosTurn(&s0, &c0, 0, N);
+        for (s32 i = 0; i <= N; ++i)
+        {
+            f64 s1 = 0, c1 = 0;
+            MathConstexpr::sinCosTurn(&s1, &c1, i + 1, N);
+            Sample& sample = mSamples[i];
+            sample.sin_val = static_cast<T>(s0);
+            sample.sin_delta = static_cast<T>(s1 - s0);
+            sample.cos_val = static_cast<T>(c0);
+            sample.cos_delta = static_cast<T>(c1 - c0);
+            s0 = s1;
+            c0 = c1;
+        }
+    }
+
+    static constexpr s32 size() { return N; }
+    constexpr const Sample& operator[](s32 i) const { return mSamples[i]; }
+    constexpr const Sample* data() const { return mSamples.data(); }
+
+    /// `idx` is an angle in the same unit as MathCalcCommon::sinIdx (a full turn is 2^32).
+    constexpr T sinIdx(u32 idx) const
+    {
+        const Sample& sample = mSamples[idx >> cShift];
+        return sample.sin_val + sample.sin_delta * static_cast<T>(idx & cRestMask) * cRestScale;
+    }
+
+    constexpr T cosIdx(u32 idx) const
+    {
+        const Sample& sample = mSamples[idx >> cShift];
+        return sample.cos_val + sample.cos_delta * static_cast<T>(idx & cRestMask) * cRestScale;
+    }
+
+    constexpr void sinCosIdx(T* p_sin, T* p_cos, u32 idx) const
+    {
+        const Sample& sample = mSamples[idx >> cShift];
+        const T rest = static_cast<T>(idx & cRestMask) * cRestScale;
+        *p_sin = sample.sin_val + sample.sin_delta * rest;
+        *p_cos = sample.cos_val + sample.cos_delta * rest;
+    }
+
+private:
+    static constexpr s32 cShift = 32 - log2(N);
+    static constexpr u32 cRestMask = (1u << cShift) - 1;
+    static constexpr T cRestScale = T(1) / static_cast<T>(1u << cShift);
+
+    std::array<Sample, N + 1> mSamples;
+};
+
+}  // namespace sead
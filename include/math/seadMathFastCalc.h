@@ -0,0 +1,257 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <prim/seadBitUtil.h>
+
+namespace sead
+{
+/// Polynomial approximations of transcendental functions for f32.
+///
+/// Unlike the functions in MathCalcCommon, these never call into libm and do not branch, so the
+/// compiler can inline and vectorize loops over them. The array overloads are provided for that
+/// purpose. Results are not guaranteed to be correctly rounded, and special values are not
+/// handled (see each function).
+///
+/// Maximum errors were measured against double precision libm over the documented ranges.
+/// ULP errors are relative to the correctly rounded f32 result.
+class MathFastCalc
+{
+public:
+    enum Precision
+    {
+        /// Fewer polynomial terms. Errors are between 1e-5 and 1e-3 depending on the function.
+        cPrecision_Low,
+        /// Close to libm: a few ULP.
+        cPrecision_High,
+    };
+
+    /// Max error: High 1.6 ULP for |x| <= pi, 1e-7 absolute for |x| <= 8192;
+    /// Low 1.4e-5 absolute for |x| <= 8192.
+    template <Precision P = cPrecision_High>
+    static f32 fastSin(f32 x);
+    /// Same error bounds as fastSin.
+    template <Precision P = cPrecision_High>
+    static f32 fastCos(f32 x);
+    /// Computes both the sine and the cosine for the cost of one range reduction.
+    template <Precision P = cPrecision_High>
+    static void fastSinCos(f32 x, f32* p_sin, f32* p_cos);
+
+    /// Returns the angle in [-pi, pi], like std::atan2 (including for signed zeros).
+    /// Max error: High 3.1 ULP; Low 8.2e-5 absolute (0.005 degrees).
+    /// The result is unspecified if either argument is infinite or NaN.
+    template <Precision P = cPrecision_High>
+    static f32 fastAtan2(f32 y, f32 x);
+
+    /// Max error for results in the normal range: High 1.3 ULP; Low 1.3e-4 relative.
+    /// Returns 0 for x <= -104 and infinity for x >= 88.73. NaN is not supported.
+    template <Precision P = cPrecision_High>
+    static f32 fastExp(f32 x);
+
+    /// x must be a positive normal number (the result for zero, negative numbers, subnormals,
+    /// infinity and NaN is unspecified).
+    /// Max error: High 0.8 ULP; Low 1.7e-4 absolute.
+    template <Precision P = cPrecision_High>
+    static f32 fastLog(f32 x);
+
+    /// Approximation of 1 / sqrt(x) from an integer estimate refined by Newton iterations.
+    /// x must be a positive normal number.
+    /// Max relative error: High (two iterations) 5e-6; Low (one iteration) 1.8e-3.
+    template <Precision P = cPrecision_High>
+    static f32 fastRsqrt(f32 x);
+
+    // Array versions. `out` may be the same array as the input.
+
+    static void fastSin(f32* out, const f32* x, s32 n, Precision p = cPrecision_High);
+    static void fastCos(f32* out, const f32* x, s32 n, Precision p = cPrecision_High);
+    static void fastSinCos(f32* out_sin, f32* out_cos, const f32* x, s32 n,
+                           Precision p = cPrecision_High);
+    static void fastAtan2(f32* out, const f32* y, const f32* x, s32 n,
+                          Precision p = cPrecision_High);
+    static void fastExp(f32* out, const f32* x, s32 n, Precision p = cPrecision_High);
+    static void fastLog(f32* out, const f32* x, s32 n, Precision p = cPrecision_High);
+    static void fastRsqrt(f32* out, const f32* x, s32 n, Precision p = cPrecision_High);
+
+private:
+    /// Rounds to the nearest integer (halfway cases away from zero). |x| must be < 2^31.
+    static s32 roundToInt_(f32 x) { return static_cast<s32>(x + (x < 0 ? -0.5f : 0.5f)); }
+    static bool isSignBitSet_(f32 x) { return (BitUtil::bitCast<u32>(x) >> 31) != 0; }
+    /// Returns cond ? a : b. Both operands are always evaluated, which keeps the compiler from
+    /// turning the selection into a branch (floating point operations are not speculated).
+    static f32 select_(bool cond, f32 a, f32 b)
+    {
+        const u32 mask = 0u - static_cast<u32>(cond);
+        return BitUtil::bitCast<f32>((BitUtil::bitCast<u32>(a) & mask) |
+                                     (BitUtil::bitCast<u32>(b) & ~mask));
+    }
+    static f32 negateIf_(bool cond, f32 x)
+    {
+        return BitUtil::bitCast<f32>(BitUtil::bitCast<u32>(x) ^ (static_cast<u32>(cond) << 31));
+    }
+    /// 2^e for -126 <= e <= 127.
+    static f32 exp2Int_(s32 e) { return BitUtil::bitCast<f32>(static_cast<u32>(e + 127) << 23); }
+};
+
+template <MathFastCalc::Precision P>
+inline void MathFastCalc::fastSinCos(f32 x, f32* p_sin, f32* p_cos)
+{
+    // Reduce to r in [-pi/4, pi/4] with x = r + k * pi/2 (Cody-Waite with a 3-part pi/2).
+    const s32 k = roundToInt_(x * 0.63661977236758134f);
+    const f32 kf = static_cast<f32>(k);
+    f32 r = x - kf * 1.5703125f;
+    r = r - kf * 4.837512969970703125e-4f;
+    r = r - kf * 7.54978995489188216e-8f;
+    const f32 z = r * r;
+
+    f32 s, c;
+    if constexpr (P == cPrecision_Low)
+    {
+        s = r + r * z * (-1.6663390404655562e-1f + z * 8.163282464441606e-3f);
+        c = 1 + z * (-4.9976055830480337e-1f + z * 4.045845469103287e-2f);
+    }
+    else
+    {
+        s = r + r * z *
+                    (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+        c = 1 - 0.5f * z +
+            z * z *
+                (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+    }
+
+    // sin(r + k * pi/2) and cos(r + k * pi/2) depending on the quadrant.
+    const bool swap = (k & 1) != 0;
+    *p_sin = negateIf_((k & 2) != 0, select_(swap, c, s));
+    *p_cos = negateIf_(((k + 1) & 2) != 0, select_(swap, s, c));
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastSin(f32 x)
+{
+    f32 s, c;
+    fastSinCos<P>(x, &s, &c);
+    return s;
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastCos(f32 x)
+{
+    f32 s, c;
+    fastSinCos<P>(x, &s, &c);
+    return c;
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastAtan2(f32 y, f32 x)
+{
+    const f32 ax = x < 0 ? -x : x;
+    const f32 ay = y < 0 ? -y : y;
+    const f32 mx = ax < ay ? ay : ax;
+    const f32 mn = ax < ay ? ax : ay;
+    const f32 t = mn / select_(mx > 0, mx, 1.0f);
+
+    // atan(t) for t in [0, 1]
+    f32 a;
+    if constexpr (P == cPrecision_Low)
+    {
+        const f32 z = t * t;
+        a = t * (9.99213845428269e-1f +
+                 z * (-3.2117500606052723e-1f +
+                      z * (1.4626432282032842e-1f + z * -3.898636126395697e-2f)));
+    }
+    else
+    {
+        // Reduce to [-tan(pi/8), tan(pi/8)] with atan(t) = pi/4 + atan((t - 1) / (t + 1)).
+        const bool big = t > 0.4142135623730950f;
+        const f32 u = select_(big, t - 1, t) / select_(big, t + 1, 1.0f);
+        const f32 z = u * u;
+        a = select_(big, 0.78539816339744831f, 0.0f) + u +
+            u * z *
+                (-3.33329491539e-1f +
+                 z * (1.99777106478e-1f + z * (-1.38776856032e-1f + z * 8.05374449538e-2f)));
+    }
+
+    a = select_(ay > ax, 1.57079632679489662f - a, a);
+    a = select_(isSignBitSet_(x), 3.14159265358979324f - a, a);
+    return negateIf_(isSignBitSet_(y), a);
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastExp(f32 x)
+{
+    x = select_(x < -104.0f, -104.0f, x);
+    x = select_(x > 89.0f, 89.0f, x);
+
+    // exp(x) = 2^k * exp(r) with r in [-ln2/2, ln2/2]
+    const s32 k = roundToInt_(x * 1.44269504088896341f);
+    const f32 kf = static_cast<f32>(k);
+    f32 r = x - kf * 0.693359375f;
+    r = r - kf * -2.12194440e-4f;
+
+    f32 p;
+    if constexpr (P == cPrecision_Low)
+    {
+        p = 1 + r + r * r * (5.039412756417755e-1f + r * 1.6662835935952822e-1f);
+    }
+    else
+    {
+        const f32 q = 8.3334519073e-3f + r * (1.3981999507e-3f + r * 1.9875691500e-4f);
+        p = 1 + r +
+            r * r * (5.0000001201e-1f + r * (1.6666665459e-1f + r * (4.1665795894e-2f + r * q)));
+    }
+
+    // Apply 2^k in two steps so that both factors are normal numbers.
+    const s32 k1 = k >> 1;
+    return p * exp2Int_(k1) * exp2Int_(k - k1);
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastLog(f32 x)
+{
+    // x = m * 2^e with m in [sqrt(1/2), sqrt(2))
+    const u32 bits = BitUtil::bitCast<u32>(x);
+    s32 e = static_cast<s32>(bits >> 23) - 127;
+    f32 m = BitUtil::bitCast<f32>((bits & 0x7fffff) | 0x3f800000);
+    const bool high = m > 1.41421356237309505f;
+    m *= select_(high, 0.5f, 1.0f);
+    e += high ? 1 : 0;
+
+    const f32 f = m - 1;
+    const f32 z = f * f;
+    const f32 ef = static_cast<f32>(e);
+
+    if constexpr (P == cPrecision_Low)
+    {
+        return f +
+               z * (-5.018386076636894e-1f +
+                    f * (3.5079130198076625e-1f + f * -2.2511104348327654e-1f)) +
+               ef * 0.693147180559945309f;
+    }
+    else
+    {
+        f32 y = f * z *
+                (3.3333331174e-1f +
+                 f * (-2.4999993993e-1f +
+                      f * (2.0000714765e-1f +
+                           f * (-1.6668057665e-1f +
+                                f * (1.4249322787e-1f +
+                                     f * (-1.2420140846e-1f +
+                                          f * (1.1676998740e-1f +
+                                               f * (-1.1514610310e-1f +
+                                                    f * 7.0376836292e-2f))))))));
+        y += ef * -2.12194440e-4f;
+        y += -0.5f * z;
+        return f + y + ef * 0.693359375f;
+    }
+}
+
+template <MathFastCalc::Precision P>
+inline f32 MathFastCalc::fastRsqrt(f32 x)
+{
+    f32 y = BitUtil::bitCast<f32>(0x5f375a86 - (BitUtil::bitCast<u32>(x) >> 1));
+    const f32 half_x = 0.5f * x;
+    y = y * (1.5f - half_x * y * y);
+    if constexpr (P == cPrecision_High)
+        y = y * (1.5f - half_x * y * y);
+    return y;
+}
+
+}  // namespace sead
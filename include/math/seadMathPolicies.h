@@ -2,6 +2,20 @@
 
 #include <math/seadMathBase.h>
 
+// Selects the SIMD implementation that is used for some f32 calc common functions
+// (see seadMathSimd.h). Matching builds only keep the SIMD code that Nintendo wrote.
+#if !defined(SEAD_MATH_NO_SIMD) && !defined(MATCHING_HACK_NX_CLANG)
+#if defined(__aarch64__)
+#define SEAD_MATH_SIMD_NEON
+#elif defined(__SSE__)
+#define SEAD_MATH_SIMD_SSE
+#endif
+#endif
+
+#if defined(SEAD_MATH_SIMD_NEON) || defined(SEAD_MATH_SIMD_SSE)
+#define SEAD_MATH_SIMD
+#endif
+
 namespace sead
 {
 template <typename T>
@@ -0,0 +1,311 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <math/seadMathPolicies.h>
+
+#if defined(SEAD_MATH_SIMD_NEON)
+#include <arm_neon.h>
+#elif defined(SEAD_MATH_SIMD_SSE)
+#include <xmmintrin.h>
+#endif
+
+#ifdef SEAD_MATH_SIMD
+
+namespace sead
+{
+namespace detail
+{
+// Thin wrappers around 4 x f32 vector intrinsics, so that the SIMD specializations of calc common
+// functions only need to be written once. All loads and stores are unaligned: matrix rows are
+// 16 bytes long but matrices are only guaranteed to be 4-byte aligned.
+
+#if defined(SEAD_MATH_SIMD_NEON)
+
+using F32x4 = float32x4_t;
+
+inline F32x4 simdLoad(const f32* p)
+{
+    return vld1q_f32(p);
+}
+
+inline void simdStore(f32* p, F32x4 v)
+{
+    vst1q_f32(p, v);
+}
+
+/// Stores lanes 0-2.
+inline void simdStore3(f32* p, F32x4 v)
+{
+    vst1_f32(p, vget_low_f32(v));
+    vst1q_lane_f32(p + 2, v, 2);
+}
+
+inline F32x4 simdSet(f32 x, f32 y, f32 z, f32 w)
+{
+    const f32 v[4] = {x, y, z, w};
+    return vld1q_f32(v);
+}
+
+inline F32x4 simdSplat(f32 x)
+{
+    return vdupq_n_f32(x);
+}
+
+template <int Lane>
+inline F32x4 simdSplatLane(F32x4 v)
+{
+    return vdupq_laneq_f32(v, Lane);
+}
+
+template <int Lane>
+inline f32 simdGetLane(F32x4 v)
+{
+    return vgetq_lane_f32(v, Lane);
+}
+
+inline F32x4 simdAdd(F32x4 a, F32x4 b)
+{
+    return vaddq_f32(a, b);
+}
+
+inline F32x4 simdSub(F32x4 a, F32x4 b)
+{
+    return vsubq_f32(a, b);
+}
+
+inline F32x4 simdMul(F32x4 a, F32x4 b)
+{
+    return vmulq_f32(a, b);
+}
+
+inline F32x4 simdMin(F32x4 a, F32x4 b)
+{
+    return vminq_f32(a, b);
+}
+
+inline F32x4 simdMax(F32x4 a, F32x4 b)
+{
+    return vmaxq_f32(a, b);
+}
+
+inline F32x4 simdAbs(F32x4 v)
+{
+    return vabsq_f32(v);
+}
+
+/// Returns a lane mask (all bits set or cleared) of a >= b.
+inline F32x4 simdCmpGe(F32x4 a, F32x4 b)
+{
+    return vreinterpretq_f32_u32(vcgeq_f32(a, b));
+}
+
+inline F32x4 simdAnd(F32x4 a, F32x4 b)
+{
+    return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(a), vreinterpretq_u32_f32(b)));
+}
+
+/// Packs the sign bit of every lane into bits 0-3.
+inline u32 simdMoveMask(F32x4 v)
+{
+    const s32 shifts[4] = {0, 1, 2, 3};
+    const uint32x4_t bits = vshrq_n_u32(vreinterpretq_u32_f32(v), 31);
+    return vaddvq_u32(vshlq_u32(bits, vld1q_s32(shifts)));
+}
+
+/// Returns (v.y, v.z, v.x, undefined).
+inline F32x4 simdSwizzleYZX(F32x4 v)
+{
+    return vcopyq_laneq_f32(vextq_f32(v, v, 1), 2, v, 0);
+}
+
+/// Returns (v.z, v.x, v.y, undefined).
+inline F32x4 simdSwizzleZXY(F32x4 v)
+{
+    return vcopyq_laneq_f32(vcopyq_laneq_f32(vextq_f32(v, v, 2), 1, v, 0), 2, v, 1);
+}
+
+inline void simdTranspose(F32x4& r0, F32x4& r1, F32x4& r2, F32x4& r3)
+{
+    const F32x4 t0 = vtrn1q_f32(r0, r1);
+    const F32x4 t1 = vtrn2q_f32(r0, r1);
+    const F32x4 t2 = vtrn1q_f32(r2, r3);
+    const F32x4 t3 = vtrn2q_f32(r2, r3);
+
+    r0 = vreinterpretq_f32_f64(
+        vzip1q_f64(vreinterpretq_f64_f32(t0), vreinterpretq_f64_f32(t2)));
+    r1 = vreinterpretq_f32_f64(
+        vzip1q_f64(vreinterpretq_f64_f32(t1), vreinterpretq_f64_f32(t3)));
+    r2 = vreinterpretq_f32_f64(
+        vzip2q_f64(vreinterpretq_f64_f32(t0), vreinterpretq_f64_f32(t2)));
+    r3 = vreinterpretq_f32_f64(
+        vzip2q_f64(vreinterpretq_f64_f32(t1), vreinterpretq_f64_f32(t3)));
+}
+
+/// Loads 4 consecutive xyz triples and returns their components in x, y and z.
+inline void simdLoadDeinterleave3(const f32* p, F32x4& x, F32x4& y, F32x4& z)
+{
+    const float32x4x3_t v = vld3q_f32(p);
+    x = v.val[0];
+    y = v.val[1];
+    z = v.val[2];
+}
+
+/// Stores 4 consecutive xyz triples. Inverse of simdLoadDeinterleave3.
+inline void simdStoreInterleave3(f32* p, F32x4 x, F32x4 y, F32x4 z)
+{
+    float32x4x3_t v;
+    v.val[0] = x;
+    v.val[1] = y;
+    v.val[2] = z;
+    vst3q_f32(p, v);
+}
+
+#elif defined(SEAD_MATH_SIMD_SSE)
+
+using F32x4 = __m128;
+
+inline F32x4 simdLoad(const f32* p)
+{
+    return _mm_loadu_ps(p);
+}
+
+inline void simdStore(f32* p, F32x4 v)
+{
+    _mm_storeu_ps(p, v);
+}
+
+/// Stores lanes 0-2.
+inline void simdStore3(f32* p, F32x4 v)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(p), v);
+    _mm_store_ss(p + 2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+}
+
+inline F32x4 simdSet(f32 x, f32 y, f32 z, f32 w)
+{
+    return _mm_setr_ps(x, y, z, w);
+}
+
+inline F32x4 simdSplat(f32 x)
+{
+    return _mm_set1_ps(x);
+}
+
+template <int Lane>
+inline F32x4 simdSplatLane(F32x4 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+}
+
+template <int Lane>
+inline f32 simdGetLane(F32x4 v)
+{
+    return _mm_cvtss_f32(simdSplatLane<Lane>(v));
+}
+
+inline F32x4 simdAdd(F32x4 a, F32x4 b)
+{
+    return _mm_add_ps(a, b);
+}
+
+inline F32x4 simdSub(F32x4 a, F32x4 b)
+{
+    return _mm_sub_ps(a, b);
+}
+
+inline F32x4 simdMul(F32x4 a, F32x4 b)
+{
+    return _mm_mul_ps(a, b);
+}
+
+inline F32x4 simdMin(F32x4 a, F32x4 b)
+{
+    return _mm_min_ps(a, b);
+}
+
+inline F32x4 simdMax(F32x4 a, F32x4 b)
+{
+    return _mm_max_ps(a, b);
+}
+
+inline F32x4 simdAbs(F32x4 v)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), v);
+}
+
+/// Returns a lane mask (all bits set or cleared) of a >= b.
+inline F32x4 simdCmpGe(F32x4 a, F32x4 b)
+{
+    return _mm_cmpge_ps(a, b);
+}
+
+inline F32x4 simdAnd(F32x4 a, F32x4 b)
+{
+    return _mm_and_ps(a, b);
+}
+
+/// Packs the sign bit of every lane into bits 0-3.
+inline u32 simdMoveMask(F32x4 v)
+{
+    return static_cast<u32>(_mm_movemask_ps(v));
+}
+
+/// Returns (v.y, v.z, v.x, undefined).
+inline F32x4 simdSwizzleYZX(F32x4 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+/// Returns (v.z, v.x, v.y, undefined).
+inline F32x4 simdSwizzleZXY(F32x4 v)
+{
+    return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 1, 0, 2));
+}
+
+inline void simdTranspose(F32x4& r0, F32x4& r1, F32x4& r2, F32x4& r3)
+{
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+}
+
+/// Loads 4 consecutive xyz triples and returns their components in x, y and z.
+inline void simdLoadDeinterleave3(const f32* p, F32x4& x, F32x4& y, F32x4& z)
+{
+    const F32x4 p0 = _mm_loadu_ps(p);      // x0 y0 z0 x1
+    const F32x4 p1 = _mm_loadu_ps(p + 4);  // y1 z1 x2 y2
+    const F32x4 p2 = _mm_loadu_ps(p + 8);  // z2 x3 y3 z3
+
+    const F32x4 t0 = _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 0, 3, 2));  // x2 y2 z2 x3
+    const F32x4 t1 = _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 0, 2, 1));  // y0 z0 y1 z1
+    const F32x4 t2 = _mm_shuffle_ps(t0, p2, _MM_SHUFFLE(3, 2, 2, 1));  // y2 z2 y3 z3
+
+    x = _mm_shuffle_ps(p0, t0, _MM_SHUFFLE(3, 0, 3, 0));
+    y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+/// Stores 4 consecutive xyz triples. Inverse of simdLoadDeinterleave3.
+inline void simdStoreInterleave3(f32* p, F32x4 x, F32x4 y, F32x4 z)
+{
+    const F32x4 t0 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 0, 2, 0));  // x0 x2 y0 y2
+    const F32x4 t1 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(3, 1, 3, 1));  // x1 x3 y1 y3
+    const F32x4 t2 = _mm_shuffle_ps(z, t1, _MM_SHUFFLE(2, 0, 1, 0));  // z0 z1 x1 y1
+    const F32x4 t3 = _mm_shuffle_ps(z, t1, _MM_SHUFFLE(3, 1, 3, 2));  // z2 z3 x3 y3
+
+    _mm_storeu_ps(p, _mm_shuffle_ps(t0, t2, _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(t2, t0, _MM_SHUFFLE(3, 1, 1, 3)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(t3, t3, _MM_SHUFFLE(1, 3, 2, 0)));
+}
+
+#endif
+
+/// Cross product of the xyz components. Lane 3 of the result is undefined.
+inline F32x4 simdCross3(F32x4 a, F32x4 b)
+{
+    return simdSub(simdMul(simdSwizzleYZX(a), simdSwizzleZXY(b)),
+                   simdMul(simdSwizzleZXY(a), simdSwizzleYZX(b)));
+}
+
+}  // namespace detail
+}  // namespace sead
+
+#endif  // SEAD_MATH_SIMD
@@ -30,20 +30,20 @@ public:
 
     Matrix22(const Self& n) = default;
 
-    Matrix22(T a00, T a01, T a10, T a11);
+    constexpr Matrix22(T a00, T a01, T a10, T a11);
 
     T operator()(s32 i, s32 j) const;
     T& operator()(s32 i, s32 j);
-    Self& operator=(const Self& n);
+    constexpr Self& operator=(const Self& n);
 
-    void makeIdentity();
-    void makeZero();
+    constexpr void makeIdentity();
+    constexpr void makeZero();
 
     void setInverse(const Self& n);
     void setInverseTranspose(const Self& n);
-    void setMul(const Self& a, const Self& b);
+    constexpr void setMul(const Self& a, const Self& b);
     void setTranspose(const Self& n);
-    void transpose();
+    constexpr void transpose();
 
     static const Matrix22 zero;
     static const Matrix22 ident;
@@ -63,30 +63,30 @@ public:
 
     Matrix33(const Self& n) = default;
 
-    Matrix33(T a00, T a01, T a02, T a10, T a11, T a12, T a20, T a21, T a22);
+    constexpr Matrix33(T a00, T a01, T a02, T a10, T a11, T a12, T a20, T a21, T a22);
 
     Matrix33(const Mtx34& mtx34);
 
     T operator()(s32 i, s32 j) const;
     T& operator()(s32 i, s32 j);
-    Self& operator=(const Self& n);
+    constexpr Self& operator=(const Self& n);
 
-    void makeIdentity();
-    void makeZero();
+    constexpr void makeIdentity();
+    constexpr void makeZero();
 
     void setInverse(const Self& n);
     void setInverseTranspose(const Self& n);
-    void setMul(const Self& a, const Self& b);
-    void setMul(const Mtx34& a, const Self& b);
-    void setMul(const Self& a, const Mtx34& b);
+    constexpr void setMul(const Self& a, const Self& b);
+    constexpr void setMul(const Mtx34& a, const Self& b);
+    constexpr void setMul(const Self& a, const Mtx34& b);
     void setTranspose(const Self& n);
-    void transpose();
+    constexpr void transpose();
 
-    void fromQuat(const Quat<T>& q);
+    constexpr void fromQuat(const Quat<T>& q);
     void makeR(const Vec3& r);
     void makeRIdx(u32 xr, u32 yr, u32 zr);
     void makeRzxyIdx(u32 xr, u32 yr, u32 zr);
-    void makeS(const Vec3& s);
+    constexpr void makeS(const Vec3& s);
     void makeS(T x, T y, T z);
     void makeSR(const Vec3& s, const Vec3& r);
     void makeSRIdx(const Vec3& s, const Vector3<u32>& r);
@@ -96,10 +96,10 @@ public:
     Vec3 getBase(s32 axis) const;
     Vec3 getRow(s32 row) const;
 
-    void getBase(Vec3& o, s32 axis) const;
-    void getRow(Vec3& o, s32 row) const;
-    void setBase(s32 axis, const Vec3& v);
-    void setRow(s32 row, const Vec3& v);
+    constexpr void getBase(Vec3& o, s32 axis) const;
+    constexpr void getRow(Vec3& o, s32 row) const;
+    constexpr void setBase(s32 axis, const Vec3& v);
+    constexpr void setRow(s32 row, const Vec3& v);
 
     static const Matrix33 zero;
     static const Matrix33 ident;
@@ -122,17 +122,18 @@ public:
 
     Matrix34(const Self& n) = default;
 
-    Matrix34(T _00, T _01, T _02, T _03, T _10, T _11, T _12, T _13, T _20, T _21, T _22, T _23);
+    constexpr Matrix34(T _00, T _01, T _02, T _03, T _10, T _11, T _12, T _13, T _20, T _21, T _22,
+                       T _23);
 
     Matrix34(const Mtx33& mtx33, const Vec3& t = Vec3::zero);
     Matrix34(const Mtx44& mtx44);
 
     T operator()(s32 i, s32 j) const;
     T& operator()(s32 i, s32 j);
-    Self& operator=(const Self& n);
+    constexpr Self& operator=(const Self& n);
 
-    void makeIdentity();
-    void makeZero();
+    constexpr void makeIdentity();
+    constexpr void makeZero();
 
     bool invert();
     bool invert33();
@@ -164,31 +165,31 @@ public:
         return lhs * rhs;
     }
 
-    void setMul(const Self& a, const Self& b);
-    void setMul(const Mtx33& a, const Self& b);
+    constexpr void setMul(const Self& a, const Self& b);
+    constexpr void setMul(const Mtx33& a, const Self& b);
 
     void setTranspose(const Self& n);
-    void transpose();
+    constexpr void transpose();
 
-    void fromQuat(const QuatT& q);
-    void makeQT(const QuatT& q, const Vec3& t);
+    constexpr void fromQuat(const QuatT& q);
+    constexpr void makeQT(const QuatT& q, const Vec3& t);
     void makeR(const Vec3& r);
     void makeRIdx(u32 xr, u32 yr, u32 zr);
     void makeRT(const Vec3& r, const Vec3& t);
     void makeRTIdx(const Vector3<u32>& r, const Vec3& t);
     void makeRzxyIdx(u32 xr, u32 yr, u32 zr);
     void makeRzxyTIdx(const Vector3<u32>& r, const Vec3& t);
-    void makeS(const Vec3& s);
+    constexpr void makeS(const Vec3& s);
     void makeS(T x, T y, T z);
-    void makeSQT(const Vec3& s, const QuatT& q, const Vec3& t);
+    constexpr void makeSQT(const Vec3& s, const QuatT& q, const Vec3& t);
     void makeSR(const Vec3& s, const Vec3& r);
     void makeSRIdx(const Vec3& s, const Vector3<u32>& r);
     void makeSRT(const Vec3& s, const Vec3& r, const Vec3& t);
     void makeSRTIdx(const Vec3& s, const Vector3<u32>& r, const Vec3& t);
     void makeSRzxyIdx(const Vec3& s, const Vector3<u32>& r);
     void makeSRzxyTIdx(const Vec3& s, const Vector3<u32>& r, const Vec3& t);
-    void makeST(const Vec3& s, const Vec3& t);
-    void makeT(const Vec3& t);
+    constexpr void makeST(const Vec3& s, const Vec3& t);
+    constexpr void makeT(const Vec3& t);
     void makeT(T x, T y, T z);
     void toQuat(QuatT& q) const;
 
@@ -197,16 +198,16 @@ public:
     Vec3 getTranslation() const;
     Vec3 getRotation() const;
 
-    void getBase(Vec3& o, s32 axis) const;
-    void getRow(Vec4& o, s32 row) const;
-    void getTranslation(Vec3& o) const;
+    constexpr void getBase(Vec3& o, s32 axis) const;
+    constexpr void getRow(Vec4& o, s32 row) const;
+    constexpr void getTranslation(Vec3& o) const;
     void getRotation(Vec3& o) const;
 
-    void scaleAllElements(T s);
-    void scaleBases(T sx, T sy, T sz);
-    void setBase(s32 axis, const Vec3& v);
-    void setRow(s32 row, const Vec4& v);
-    void setTranslation(const Vec3& t);
+    constexpr void scaleAllElements(T s);
+    constexpr void scaleBases(T sx, T sy, T sz);
+    constexpr void setBase(s32 axis, const Vec3& v);
+    constexpr void setRow(s32 row, const Vec4& v);
+    constexpr void setTranslation(const Vec3& t);
     void setTranslation(T x, T y, T z);
 
     static const Matrix34 zero;
@@ -229,28 +230,28 @@ public:
 
     Matrix44(const Self& n) = default;
 
-    Matrix44(T _00, T _01, T _02, T _03, T _10, T _11, T _12, T _13, T _20, T _21, T _22, T _23,
-             T _30, T _31, T _32, T _33);
+    constexpr Matrix44(T _00, T _01, T _02, T _03, T _10, T _11, T _12, T _13, T _20, T _21, T _22,
+                       T _23, T _30, T _31, T _32, T _33);
 
     Matrix44(const Mtx33& mtx33, const Vec3& t = Vec3::zero, const Vec4& vw = Vec4::ew);
     Matrix44(const Mtx34& mtx34, const Vec4& vw = Vec4::ew);
 
     T operator()(s32 i, s32 j) const;
     T& operator()(s32 i, s32 j);
-    Self& operator=(const Self& n);
+    constexpr Self& operator=(const Self& n);
 
-    void makeIdentity();
-    void makeZero();
+    constexpr void makeIdentity();
+    constexpr void makeZero();
 
     void setInverse(const Self& n);
     void setInverseTranspose(const Self& n);
-    void setMul(const Self& a, const Self& b);
-    void setMul(const Mtx34& a, const Self& b);
-    void setMul(const Self& a, const Mtx34& b);
+    constexpr void setMul(const Self& a, const Self& b);
+    constexpr void setMul(const Mtx34& a, const Self& b);
+    constexpr void setMul(const Self& a, const Mtx34& b);
     void setTranspose(const Self& n);
-    void transpose();
+    constexpr void transpose();
 
-    void fromQuat(const Quat<T>& q);
+    constexpr void fromQuat(const Quat<T>& q);
     void makeR(const Vec3& r);
     void makeRIdx(u32 xr, u32 yr, u32 zr);
     void makeRzxyIdx(u32 xr, u32 yr, u32 zr);
@@ -259,13 +260,13 @@ public:
     Vec4 getCol(s32 axis) const;
     Vec4 getRow(s32 row) const;
 
-    void getCol(Vec4& o, s32 axis) const;
-    void getRow(Vec4& o, s32 row) const;
+    constexpr void getCol(Vec4& o, s32 axis) const;
+    constexpr void getRow(Vec4& o, s32 row) const;
 
-    void scaleAllElements(T s);
-    void scaleBases(T sx, T sy, T sz, T sw);
-    void setCol(s32 axis, const Vec4& v);
-    void setRow(s32 row, const Vec4& v);
+    constexpr void scaleAllElements(T s);
+    constexpr void scaleBases(T sx, T sy, T sz, T sw);
+    constexpr void setCol(s32 axis, const Vec4& v);
+    constexpr void setRow(s32 row, const Vec4& v);
 
     static const Matrix44 zero;
     static const Matrix44 ident;
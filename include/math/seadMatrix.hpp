@@ -8,13 +8,9 @@
 namespace sead
 {
 template <typename T>
-inline Matrix22<T>::Matrix22(T a00, T a01, T a10, T a11)
+constexpr Matrix22<T>::Matrix22(T a00, T a01, T a10, T a11)
+    : Policies<T>::Mtx22Base{{{{a00, a01}, {a10, a11}}}}
 {
-    this->m[0][0] = a00;
-    this->m[0][1] = a01;
-
-    this->m[1][0] = a10;
-    this->m[1][1] = a11;
 }
 
 template <typename T>
@@ -30,20 +26,20 @@ inline T& Matrix22<T>::operator()(s32 i, s32 j)
 }
 
 template <typename T>
-inline Matrix22<T>& Matrix22<T>::operator=(const Self& n)
+constexpr Matrix22<T>& Matrix22<T>::operator=(const Self& n)
 {
     Matrix22CalcCommon<T>::copy(*this, n);
     return *this;
 }
 
 template <typename T>
-inline void Matrix22<T>::makeIdentity()
+constexpr void Matrix22<T>::makeIdentity()
 {
     Matrix22CalcCommon<T>::makeIdentity(*this);
 }
 
 template <typename T>
-inline void Matrix22<T>::makeZero()
+constexpr void Matrix22<T>::makeZero()
 {
     Matrix22CalcCommon<T>::makeZero(*this);
 }
@@ -61,7 +57,7 @@ inline void Matrix22<T>::setInverseTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix22<T>::setMul(const Self& a, const Self& b)
+constexpr void Matrix22<T>::setMul(const Self& a, const Self& b)
 {
     Matrix22CalcCommon<T>::multiply(*this, a, b);
 }
@@ -73,25 +69,15 @@ inline void Matrix22<T>::setTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix22<T>::transpose()
+constexpr void Matrix22<T>::transpose()
 {
     Matrix22CalcCommon<T>::transpose(*this);
 }
 
 template <typename T>
-inline Matrix33<T>::Matrix33(T a00, T a01, T a02, T a10, T a11, T a12, T a20, T a21, T a22)
+constexpr Matrix33<T>::Matrix33(T a00, T a01, T a02, T a10, T a11, T a12, T a20, T a21, T a22)
+    : Policies<T>::Mtx33Base{{{{a00, a01, a02}, {a10, a11, a12}, {a20, a21, a22}}}}
 {
-    this->m[0][0] = a00;
-    this->m[0][1] = a01;
-    this->m[0][2] = a02;
-
-    this->m[1][0] = a10;
-    this->m[1][1] = a11;
-    this->m[1][2] = a12;
-
-    this->m[2][0] = a20;
-    this->m[2][1] = a21;
-    this->m[2][2] = a22;
 }
 
 template <typename T>
@@ -113,20 +99,20 @@ inline T& Matrix33<T>::operator()(s32 i, s32 j)
 }
 
 template <typename T>
-inline Matrix33<T>& Matrix33<T>::operator=(const Self& n)
+constexpr Matrix33<T>& Matrix33<T>::operator=(const Self& n)
 {
     Matrix33CalcCommon<T>::copy(*this, n);
     return *this;
 }
 
 template <typename T>
-inline void Matrix33<T>::makeIdentity()
+constexpr void Matrix33<T>::makeIdentity()
 {
     Matrix33CalcCommon<T>::makeIdentity(*this);
 }
 
 template <typename T>
-inline void Matrix33<T>::makeZero()
+constexpr void Matrix33<T>::makeZero()
 {
     Matrix33CalcCommon<T>::makeZero(*this);
 }
@@ -144,19 +130,19 @@ inline void Matrix33<T>::setInverseTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix33<T>::setMul(const Self& a, const Self& b)
+constexpr void Matrix33<T>::setMul(const Self& a, const Self& b)
 {
     Matrix33CalcCommon<T>::multiply(*this, a, b);
 }
 
 template <typename T>
-inline void Matrix33<T>::setMul(const Mtx34& a, const Self& b)
+constexpr void Matrix33<T>::setMul(const Mtx34& a, const Self& b)
 {
     Matrix33CalcCommon<T>::multiply(*this, a, b);
 }
 
 template <typename T>
-inline void Matrix33<T>::setMul(const Self& a, const Mtx34& b)
+constexpr void Matrix33<T>::setMul(const Self& a, const Mtx34& b)
 {
     Matrix33CalcCommon<T>::multiply(*this, a, b);
 }
@@ -168,13 +154,13 @@ inline void Matrix33<T>::setTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix33<T>::transpose()
+constexpr void Matrix33<T>::transpose()
 {
     Matrix33CalcCommon<T>::transpose(*this);
 }
 
 template <typename T>
-inline void Matrix33<T>::fromQuat(const Quat<T>& q)
+constexpr void Matrix33<T>::fromQuat(const Quat<T>& q)
 {
     Matrix33CalcCommon<T>::makeQ(*this, q);
 }
@@ -198,7 +184,7 @@ inline void Matrix33<T>::makeRzxyIdx(u32 xr, u32 yr, u32 zr)
 }
 
 template <typename T>
-inline void Matrix33<T>::makeS(const Vec3& s)
+constexpr void Matrix33<T>::makeS(const Vec3& s)
 {
     Matrix33CalcCommon<T>::makeS(*this, s);
 }
@@ -251,47 +237,34 @@ inline Vector3<T> Matrix33<T>::getRow(s32 axis) const
 }
 
 template <typename T>
-inline void Matrix33<T>::getBase(Vec3& o, s32 axis) const
+constexpr void Matrix33<T>::getBase(Vec3& o, s32 axis) const
 {
     Matrix33CalcCommon<T>::getBase(o, *this, axis);
 }
 
 template <typename T>
-inline void Matrix33<T>::getRow(Vec3& o, s32 row) const
+constexpr void Matrix33<T>::getRow(Vec3& o, s32 row) const
 {
     Matrix33CalcCommon<T>::getRow(o, *this, row);
 }
 
 template <typename T>
-inline void Matrix33<T>::setBase(s32 axis, const Vec3& v)
+constexpr void Matrix33<T>::setBase(s32 axis, const Vec3& v)
 {
     Matrix33CalcCommon<T>::setBase(*this, axis, v);
 }
 
 template <typename T>
-inline void Matrix33<T>::setRow(s32 row, const Vec3& v)
+constexpr void Matrix33<T>::setRow(s32 row, const Vec3& v)
 {
     Matrix33CalcCommon<T>::setRow(*this, v, row);
 }
 
 template <typename T>
-inline Matrix34<T>::Matrix34(T a00, T a01, T a02, T a03, T a10, T a11, T a12, T a13, T a20, T a21,
-                             T a22, T a23)
+constexpr Matrix34<T>::Matrix34(T a00, T a01, T a02, T a03, T a10, T a11, T a12, T a13, T a20,
+                                T a21, T a22, T a23)
+    : Policies<T>::Mtx34Base{{{{a00, a01, a02, a03}, {a10, a11, a12, a13}, {a20, a21, a22, a23}}}}
 {
-    this->m[0][0] = a00;
-    this->m[0][1] = a01;
-    this->m[0][2] = a02;
-    this->m[0][3] = a03;
-
-    this->m[1][0] = a10;
-    this->m[1][1] = a11;
-    this->m[1][2] = a12;
-    this->m[1][3] = a13;
-
-    this->m[2][0] = a20;
-    this->m[2][1] = a21;
-    this->m[2][2] = a22;
-    this->m[2][3] = a23;
 }
 
 template <typename T>
@@ -319,20 +292,20 @@ inline T& Matrix34<T>::operator()(s32 i, s32 j)
 }
 
 template <typename T>
-inline Matrix34<T>& Matrix34<T>::operator=(const Self& n)
+constexpr Matrix34<T>& Matrix34<T>::operator=(const Self& n)
 {
     Matrix34CalcCommon<T>::copy(*this, n);
     return *this;
 }
 
 template <typename T>
-inline void Matrix34<T>::makeIdentity()
+constexpr void Matrix34<T>::makeIdentity()
 {
     Matrix34CalcCommon<T>::makeIdentity(*this);
 }
 
 template <typename T>
-inline void Matrix34<T>::makeZero()
+constexpr void Matrix34<T>::makeZero()
 {
     Matrix34CalcCommon<T>::makeZero(*this);
 }
@@ -374,13 +347,13 @@ inline bool Matrix34<T>::setInverseTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix34<T>::setMul(const Self& a, const Self& b)
+constexpr void Matrix34<T>::setMul(const Self& a, const Self& b)
 {
     Matrix34CalcCommon<T>::multiply(*this, a, b);
 }
 
 template <typename T>
-inline void Matrix34<T>::setMul(const Mtx33& a, const Self& b)
+constexpr void Matrix34<T>::setMul(const Mtx33& a, const Self& b)
 {
     Matrix34CalcCommon<T>::multiply(*this, a, b);
 }
@@ -392,19 +365,19 @@ inline void Matrix34<T>::setTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix34<T>::transpose()
+constexpr void Matrix34<T>::transpose()
 {
     Matrix34CalcCommon<T>::transpose(*this);
 }
 
 template <typename T>
-inline void Matrix34<T>::fromQuat(const QuatT& q)
+constexpr void Matrix34<T>::fromQuat(const QuatT& q)
 {
     Matrix34CalcCommon<T>::makeQ(*this, q);
 }
 
 template <typename T>
-inline void Matrix34<T>::makeQT(const QuatT& q, const Vec3& t)
+constexpr void Matrix34<T>::makeQT(const QuatT& q, const Vec3& t)
 {
     Matrix34CalcCommon<T>::makeQT(*this, q, t);
 }
@@ -446,7 +419,7 @@ inline void Matrix34<T>::makeRzxyTIdx(const Vector3<u32>& r, const Vec3& t)
 }
 
 template <typename T>
-inline void Matrix34<T>::makeS(const Vec3& s)
+constexpr void Matrix34<T>::makeS(const Vec3& s)
 {
     Matrix34CalcCommon<T>::makeS(*this, s);
 }
@@ -459,7 +432,7 @@ inline void Matrix34<T>::makeS(T x, T y, T z)
 }
 
 template <typename T>
-inline void Matrix34<T>::makeSQT(const Vec3& s, const QuatT& q, const Vec3& t)
+constexpr void Matrix34<T>::makeSQT(const Vec3& s, const QuatT& q, const Vec3& t)
 {
     Matrix34CalcCommon<T>::makeSQT(*this, s, q, t);
 }
@@ -501,13 +474,13 @@ inline void Matrix34<T>::makeSRzxyTIdx(const Vec3& s, const Vector3<u32>& r, con
 }
 
 template <typename T>
-inline void Matrix34<T>::makeST(const Vec3& s, const Vec3& t)
+constexpr void Matrix34<T>::makeST(const Vec3& s, const Vec3& t)
 {
     Matrix34CalcCommon<T>::makeST(*this, s, t);
 }
 
 template <typename T>
-inline void Matrix34<T>::makeT(const Vec3& t)
+constexpr void Matrix34<T>::makeT(const Vec3& t)
 {
     Matrix34CalcCommon<T>::makeT(*this, t);
 }
@@ -558,19 +531,19 @@ inline Vector3<T> Matrix34<T>::getRotation() const
 }
 
 template <typename T>
-inline void Matrix34<T>::getBase(Vec3& o, s32 axis) const
+constexpr void Matrix34<T>::getBase(Vec3& o, s32 axis) const
 {
     Matrix34CalcCommon<T>::getBase(o, *this, axis);
 }
 
 template <typename T>
-inline void Matrix34<T>::getRow(Vec4& o, s32 row) const
+constexpr void Matrix34<T>::getRow(Vec4& o, s32 row) const
 {
     Matrix34CalcCommon<T>::getRow(o, *this, row);
 }
 
 template <typename T>
-inline void Matrix34<T>::getTranslation(Vec3& o) const
+constexpr void Matrix34<T>::getTranslation(Vec3& o) const
 {
     Matrix34CalcCommon<T>::getTranslation(o, *this);
 }
@@ -582,31 +555,31 @@ inline void Matrix34<T>::getRotation(Vec3& o) const
 }
 
 template <typename T>
-inline void Matrix34<T>::scaleAllElements(T s)
+constexpr void Matrix34<T>::scaleAllElements(T s)
 {
     Matrix34CalcCommon<T>::scaleAllElements(*this, s);
 }
 
 template <typename T>
-inline void Matrix34<T>::scaleBases(T sx, T sy, T sz)
+constexpr void Matrix34<T>::scaleBases(T sx, T sy, T sz)
 {
     Matrix34CalcCommon<T>::scaleBases(*this, sx, sy, sz);
 }
 
 template <typename T>
-inline void Matrix34<T>::setBase(s32 axis, const Vec3& v)
+constexpr void Matrix34<T>::setBase(s32 axis, const Vec3& v)
 {
     Matrix34CalcCommon<T>::setBase(*this, axis, v);
 }
 
 template <typename T>
-inline void Matrix34<T>::setRow(s32 row, const Vec4& v)
+constexpr void Matrix34<T>::setRow(s32 row, const Vec4& v)
 {
     Matrix34CalcCommon<T>::setRow(*this, v, row);
 }
 
 template <typename T>
-inline void Matrix34<T>::setTranslation(const Vec3& t)
+constexpr void Matrix34<T>::setTranslation(const Vec3& t)
 {
     Matrix34CalcCommon<T>::setTranslation(*this, t);
 }
@@ -619,28 +592,13 @@ inline void Matrix34<T>::setTranslation(T x, T y, T z)
 }
 
 template <typename T>
-inline Matrix44<T>::Matrix44(T a00, T a01, T a02, T a03, T a10, T a11, T a12, T a13, T a20, T a21,
-                             T a22, T a23, T a30, T a31, T a32, T a33)
+constexpr Matrix44<T>::Matrix44(T a00, T a01, T a02, T a03, T a10, T a11, T a12, T a13, T a20,
+                                T a21, T a22, T a23, T a30, T a31, T a32, T a33)
+    : Policies<T>::Mtx44Base{{{{a00, a01, a02, a03},
+                               {a10, a11, a12, a13},
+                               {a20, a21, a22, a23},
+                               {a30, a31, a32, a33}}}}
 {
-    this->m[0][0] = a00;
-    this->m[0][1] = a01;
-    this->m[0][2] = a02;
-    this->m[0][3] = a03;
-
-    this->m[1][0] = a10;
-    this->m[1][1] = a11;
-    this->m[1][2] = a12;
-    this->m[1][3] = a13;
-
-    this->m[2][0] = a20;
-    this->m[2][1] = a21;
-    this->m[2][2] = a22;
-    this->m[2][3] = a23;
-
-    this->m[3][0] = a30;
-    this->m[3][1] = a31;
-    this->m[3][2] = a32;
-    this->m[3][3] = a33;
 }
 
 template <typename T>
@@ -668,20 +626,20 @@ inline T& Matrix44<T>::operator()(s32 i, s32 j)
 }
 
 template <typename T>
-inline Matrix44<T>& Matrix44<T>::operator=(const Self& n)
+constexpr Matrix44<T>& Matrix44<T>::operator=(const Self& n)
 {
     Matrix44CalcCommon<T>::copy(*this, n);
     return *this;
 }
 
 template <typename T>
-inline void Matrix44<T>::makeIdentity()
+constexpr void Matrix44<T>::makeIdentity()
 {
     Matrix44CalcCommon<T>::makeIdentity();
 }
 
 template <typename T>
-inline void Matrix44<T>::makeZero()
+constexpr void Matrix44<T>::makeZero()
 {
     Matrix44CalcCommon<T>::makeZero();
 }
@@ -693,19 +651,19 @@ inline void Matrix44<T>::setInverse(const Self& n)
 }
 
 template <typename T>
-inline void Matrix44<T>::setMul(const Self& a, const Self& b)
+constexpr void Matrix44<T>::setMul(const Self& a, const Self& b)
 {
     Matrix44CalcCommon<T>::multiply(*this, a, b);
 }
 
 template <typename T>
-inline void Matrix44<T>::setMul(const Mtx34& a, const Self& b)
+constexpr void Matrix44<T>::setMul(const Mtx34& a, const Self& b)
 {
     Matrix44CalcCommon<T>::multiply(*this, a, b);
 }
 
 template <typename T>
-inline void Matrix44<T>::setMul(const Self& a, const Mtx34& b)
+constexpr void Matrix44<T>::setMul(const Self& a, const Mtx34& b)
 {
     Matrix44CalcCommon<T>::multiply(*this, a, b);
 }
@@ -717,13 +675,13 @@ inline void Matrix44<T>::setTranspose(const Self& n)
 }
 
 template <typename T>
-inline void Matrix44<T>::transpose()
+constexpr void Matrix44<T>::transpose()
 {
     Matrix44CalcCommon<T>::transpose(*this);
 }
 
 template <typename T>
-inline void Matrix44<T>::fromQuat(const Quat<T>& q)
+constexpr void Matrix44<T>::fromQuat(const Quat<T>& q)
 {
     Matrix44CalcCommon<T>::makeQ(*this, q);
 }
@@ -769,37 +727,37 @@ inline Vector4<T> Matrix44<T>::getRow(s32 axis) const
 }
 
 template <typename T>
-inline void Matrix44<T>::getCol(Vec4& o, s32 axis) const
+constexpr void Matrix44<T>::getCol(Vec4& o, s32 axis) const
 {
     Matrix44CalcCommon<T>::getCol(o, *this, axis);
 }
 
 template <typename T>
-inline void Matrix44<T>::getRow(Vec4& o, s32 row) const
+constexpr void Matrix44<T>::getRow(Vec4& o, s32 row) const
 {
     Matrix44CalcCommon<T>::getRow(o, *this, row);
 }
 
 template <typename T>
-inline void Matrix44<T>::scaleAllElements(T s)
+constexpr void Matrix44<T>::scaleAllElements(T s)
 {
     Matrix44CalcCommon<T>::scaleAllElements(*this, s);
 }
 
 template <typename T>
-inline void Matrix44<T>::scaleBases(T sx, T sy, T sz, T sw)
+constexpr void Matrix44<T>::scaleBases(T sx, T sy, T sz, T sw)
 {
     Matrix44CalcCommon<T>::scaleBases(*this, sx, sy, sz, sw);
 }
 
 template <typename T>
-inline void Matrix44<T>::setCol(s32 axis, const Vec4& v)
+constexpr void Matrix44<T>::setCol(s32 axis, const Vec4& v)
 {
     Matrix44CalcCommon<T>::setCol(*this, axis, v);
 }
 
 template <typename T>
-inline void Matrix44<T>::setRow(s32 row, const Vec4& v)
+constexpr void Matrix44<T>::setRow(s32 row, const Vec4& v)
 {
     Matrix44CalcCommon<T>::setRow(*this, row, v);
 }
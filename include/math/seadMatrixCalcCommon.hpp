@@ -11,6 +11,7 @@
 #include <cmath>
 
 #include <math/seadMathCalcCommon.h>
+#include <math/seadMathSimd.h>
 #ifndef SEAD_MATH_MATRIX_CALC_COMMON_H_
 #include <math/seadMatrixCalcCommon.h>
 #endif
@@ -18,7 +19,7 @@
 namespace sead
 {
 template <typename T>
-void Matrix22CalcCommon<T>::makeIdentity(Base& o)
+constexpr void Matrix22CalcCommon<T>::makeIdentity(Base& o)
 {
     o.m[0][0] = 1;
     o.m[0][1] = 0;
@@ -28,7 +29,7 @@ void Matrix22CalcCommon<T>::makeIdentity(Base& o)
 }
 
 template <typename T>
-void Matrix22CalcCommon<T>::makeZero(Base& o)
+constexpr void Matrix22CalcCommon<T>::makeZero(Base& o)
 {
     o.m[0][0] = 0;
     o.m[0][1] = 0;
@@ -38,7 +39,7 @@ void Matrix22CalcCommon<T>::makeZero(Base& o)
 }
 
 template <typename T>
-void Matrix22CalcCommon<T>::copy(Base& o, const Base& n)
+constexpr void Matrix22CalcCommon<T>::copy(Base& o, const Base& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -92,7 +93,7 @@ void Matrix22CalcCommon<T>::inverseTranspose(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix22CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
+constexpr void Matrix22CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -114,7 +115,7 @@ void Matrix22CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 }
 
 template <typename T>
-void Matrix22CalcCommon<T>::transpose(Base& o)
+constexpr void Matrix22CalcCommon<T>::transpose(Base& o)
 {
     const T a12 = o.m[0][1];
     const T a21 = o.m[1][0];
@@ -136,7 +137,7 @@ void Matrix22CalcCommon<T>::transposeTo(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::makeIdentity(Base& o)
+constexpr void Matrix33CalcCommon<T>::makeIdentity(Base& o)
 {
     o.m[0][0] = 1;
     o.m[0][1] = 0;
@@ -152,7 +153,7 @@ void Matrix33CalcCommon<T>::makeIdentity(Base& o)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::makeZero(Base& o)
+constexpr void Matrix33CalcCommon<T>::makeZero(Base& o)
 {
     o.m[0][0] = 0;
     o.m[0][1] = 0;
@@ -168,7 +169,7 @@ void Matrix33CalcCommon<T>::makeZero(Base& o)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::copy(Base& o, const Base& n)
+constexpr void Matrix33CalcCommon<T>::copy(Base& o, const Base& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -184,7 +185,7 @@ void Matrix33CalcCommon<T>::copy(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::copy(Base& o, const Mtx34& n)
+constexpr void Matrix33CalcCommon<T>::copy(Base& o, const Mtx34& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -272,7 +273,7 @@ void Matrix33CalcCommon<T>::inverseTranspose(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
+constexpr void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -312,7 +313,7 @@ void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
+constexpr void Matrix33CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -352,7 +353,7 @@ void Matrix33CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
+constexpr void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -392,7 +393,7 @@ void Matrix33CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::transpose(Base& o)
+constexpr void Matrix33CalcCommon<T>::transpose(Base& o)
 {
     const T a12 = o.m[0][1];
     const T a13 = o.m[0][2];
@@ -432,7 +433,7 @@ void Matrix33CalcCommon<T>::transposeTo(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::makeQ(Base& o, const Quat& q)
+constexpr void Matrix33CalcCommon<T>::makeQ(Base& o, const Quat& q)
 {
     // Assuming the quaternion "q" is normalized
 
@@ -528,7 +529,7 @@ void Matrix33CalcCommon<T>::makeRzxyIdx(Base& o, u32 xr, u32 yr, u32 zr)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::makeS(Base& o, const Vec3& s)
+constexpr void Matrix33CalcCommon<T>::makeS(Base& o, const Vec3& s)
 {
     o.m[0][0] = s.x;
     o.m[1][0] = 0;
@@ -689,7 +690,7 @@ void Matrix33CalcCommon<T>::toQuat(Quat& q, const Base& n)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
+constexpr void Matrix33CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
 {
     v.x = n.m[0][axis];
     v.y = n.m[1][axis];
@@ -697,7 +698,7 @@ void Matrix33CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::getRow(Vec3& v, const Base& n, s32 row)
+constexpr void Matrix33CalcCommon<T>::getRow(Vec3& v, const Base& n, s32 row)
 {
     v.x = n.m[row][0];
     v.y = n.m[row][1];
@@ -705,7 +706,7 @@ void Matrix33CalcCommon<T>::getRow(Vec3& v, const Base& n, s32 row)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
+constexpr void Matrix33CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
 {
     n.m[0][axis] = v.x;
     n.m[1][axis] = v.y;
@@ -713,7 +714,7 @@ void Matrix33CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
 }
 
 template <typename T>
-void Matrix33CalcCommon<T>::setRow(Base& n, const Vec3& v, s32 row)
+constexpr void Matrix33CalcCommon<T>::setRow(Base& n, const Vec3& v, s32 row)
 {
     n.m[row][0] = v.x;
     n.m[row][1] = v.y;
@@ -721,7 +722,7 @@ void Matrix33CalcCommon<T>::setRow(Base& n, const Vec3& v, s32 row)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeIdentity(Base& o)
+constexpr void Matrix34CalcCommon<T>::makeIdentity(Base& o)
 {
     Matrix34CalcCommon<T>::copy(o, Base{{{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}}}});
 }
@@ -737,7 +738,7 @@ inline void Matrix34CalcCommon<f32>::makeIdentity(Base& o)
 #endif  // cafe
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeZero(Base& o)
+constexpr void Matrix34CalcCommon<T>::makeZero(Base& o)
 {
     o.m[0][0] = 0;
     o.m[0][1] = 0;
@@ -756,7 +757,7 @@ void Matrix34CalcCommon<T>::makeZero(Base& o)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::copy(Base& o, const Base& n)
+constexpr void Matrix34CalcCommon<T>::copy(Base& o, const Base& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -798,7 +799,7 @@ inline void Matrix34CalcCommon<f32>::copy(Base& o, const Base& n)
 #endif  // cafe
 
 template <typename T>
-void Matrix34CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t)
+constexpr void Matrix34CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -817,7 +818,7 @@ void Matrix34CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::copy(Base& o, const Mtx44& n)
+constexpr void Matrix34CalcCommon<T>::copy(Base& o, const Mtx44& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -893,6 +894,49 @@ bool Matrix34CalcCommon<T>::inverse(Base& o, const Base& n)
     return true;
 }
 
+#ifdef SEAD_MATH_SIMD
+
+template <>
+inline bool Matrix34CalcCommon<f32>::inverse(Base& o, const Base& n)
+{
+    using namespace detail;
+
+    const F32x4 r0 = simdLoad(n.m[0]);
+    const F32x4 r1 = simdLoad(n.m[1]);
+    const F32x4 r2 = simdLoad(n.m[2]);
+
+    // The columns of the adjugate are the cross products of the rows.
+    F32x4 c0 = simdCross3(r1, r2);
+    F32x4 c1 = simdCross3(r2, r0);
+    F32x4 c2 = simdCross3(r0, r1);
+
+    // Same evaluation order as the scalar version, so that both agree on singular matrices.
+    const f32 det = (n.m[0][0] * n.m[1][1] * n.m[2][2] - n.m[2][0] * n.m[1][1] * n.m[0][2]) +
+                    (n.m[0][1] * n.m[1][2] * n.m[2][0] - n.m[1][0] * n.m[0][1] * n.m[2][2]) +
+                    (n.m[0][2] * n.m[1][0] * n.m[2][1] - n.m[0][0] * n.m[2][1] * n.m[1][2]);
+    if (det == 0)
+        return false;
+
+    const F32x4 inv_det = simdSplat(1 / det);
+    c0 = simdMul(c0, inv_det);
+    c1 = simdMul(c1, inv_det);
+    c2 = simdMul(c2, inv_det);
+
+    const F32x4 neg_t = simdSub(simdSplat(0), simdSet(n.m[0][3], n.m[1][3], n.m[2][3], 0));
+    F32x4 t = simdMul(c0, simdSplatLane<0>(neg_t));
+    t = simdAdd(t, simdMul(c1, simdSplatLane<1>(neg_t)));
+    t = simdAdd(t, simdMul(c2, simdSplatLane<2>(neg_t)));
+
+    simdTranspose(c0, c1, c2, t);
+    simdStore(o.m[0], c0);
+    simdStore(o.m[1], c1);
+    simdStore(o.m[2], c2);
+
+    return true;
+}
+
+#endif  // SEAD_MATH_SIMD
+
 template <typename T>
 bool Matrix34CalcCommon<T>::inverse33(Base& o, const Base& n)
 {
@@ -978,7 +1022,7 @@ bool Matrix34CalcCommon<T>::inverseTranspose(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
+constexpr void Matrix34CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -1073,8 +1117,47 @@ inline void Matrix34CalcCommon<f32>::multiply(Base& o, const Base& a, const Base
 
 #endif  // cafe
 
+#ifdef SEAD_MATH_SIMD_SSE
+
+template <>
+inline void Matrix34CalcCommon<f32>::multiply(Base& o, const Base& a, const Base& b)
+{
+    using namespace detail;
+
+    const F32x4 b0 = simdLoad(b.m[0]);
+    const F32x4 b1 = simdLoad(b.m[1]);
+    const F32x4 b2 = simdLoad(b.m[2]);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        const F32x4 ai = simdLoad(a.m[i]);
+        F32x4 c = simdMul(simdSplatLane<0>(ai), b0);
+        c = simdAdd(c, simdMul(simdSplatLane<1>(ai), b1));
+        c = simdAdd(c, simdMul(simdSplatLane<2>(ai), b2));
+        c = simdAdd(c, simdSet(0, 0, 0, a.m[i][3]));
+        simdStore(o.m[i], c);
+    }
+}
+
+#endif  // SEAD_MATH_SIMD_SSE
+
+template <typename T>
+void Matrix34CalcCommon<T>::multiplyMatrices(Base* o, const Base* a, const Base* b, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        multiply(o[i], a[i], b[i]);
+}
+
+template <typename T>
+void Matrix34CalcCommon<T>::multiplyMatrices(Base* o, const Base& a, const Base* b, s32 n)
+{
+    const Base tmp = a;
+    for (s32 i = 0; i < n; ++i)
+        multiply(o[i], tmp, b[i]);
+}
+
 template <typename T>
-void Matrix34CalcCommon<T>::multiply(Base& o, const Mtx33& a, const Base& b)
+constexpr void Matrix34CalcCommon<T>::multiply(Base& o, const Mtx33& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -1120,7 +1203,7 @@ void Matrix34CalcCommon<T>::multiply(Base& o, const Mtx33& a, const Base& b)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx33& b)
+constexpr void Matrix34CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx33& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -1166,7 +1249,7 @@ void Matrix34CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx33& b)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::transpose(Base& o)
+constexpr void Matrix34CalcCommon<T>::transpose(Base& o)
 {
     const T a12 = o.m[0][1];
     const T a13 = o.m[0][2];
@@ -1225,7 +1308,7 @@ void Matrix34CalcCommon<T>::transposeTo(Base& o, const Base& n)
 #endif  // cafe
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeQ(Base& o, const Quat& q)
+constexpr void Matrix34CalcCommon<T>::makeQ(Base& o, const Quat& q)
 {
     // Assuming the quaternion "q" is normalized
 
@@ -1257,7 +1340,7 @@ void Matrix34CalcCommon<T>::makeQ(Base& o, const Quat& q)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeQT(Base& o, const Quat& q, const Vec3& t)
+constexpr void Matrix34CalcCommon<T>::makeQT(Base& o, const Quat& q, const Vec3& t)
 {
     // Assuming the quaternion "q" is normalized
 
@@ -1457,7 +1540,7 @@ void Matrix34CalcCommon<T>::makeRzxyTIdx(Base& o, const Vector3<u32>& r, const V
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeS(Base& o, const Vec3& s)
+constexpr void Matrix34CalcCommon<T>::makeS(Base& o, const Vec3& s)
 {
     o.m[0][0] = s.x;
     o.m[1][0] = 0;
@@ -1487,7 +1570,7 @@ inline void Matrix34CalcCommon<f32>::makeS(Base& o, const Vec3& s)
 #endif  // cafe
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeSQT(Base& o, const Vec3& s, const Quat& q, const Vec3& t)
+constexpr void Matrix34CalcCommon<T>::makeSQT(Base& o, const Vec3& s, const Quat& q, const Vec3& t)
 {
     // Assuming the quaternion "q" is normalized
 
@@ -1684,7 +1767,7 @@ void Matrix34CalcCommon<T>::makeSRzxyTIdx(Base& o, const Vec3& s, const Vector3<
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeST(Base& o, const Vec3& s, const Vec3& t)
+constexpr void Matrix34CalcCommon<T>::makeST(Base& o, const Vec3& s, const Vec3& t)
 {
     o.m[0][0] = s.x;
     o.m[1][0] = 0;
@@ -1704,7 +1787,7 @@ void Matrix34CalcCommon<T>::makeST(Base& o, const Vec3& s, const Vec3& t)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::makeT(Base& o, const Vec3& t)
+constexpr void Matrix34CalcCommon<T>::makeT(Base& o, const Vec3& t)
 {
     o.m[0][0] = 1;
     o.m[0][1] = 0;
@@ -1800,7 +1883,7 @@ void Matrix34CalcCommon<T>::toQuat(Quat& q, const Base& n)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
+constexpr void Matrix34CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
 {
     v.x = n.m[0][axis];
     v.y = n.m[1][axis];
@@ -1808,7 +1891,7 @@ void Matrix34CalcCommon<T>::getBase(Vec3& v, const Base& n, s32 axis)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
+constexpr void Matrix34CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
 {
     v.x = n.m[row][0];
     v.y = n.m[row][1];
@@ -1817,7 +1900,7 @@ void Matrix34CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::getTranslation(Vec3& v, const Base& n)
+constexpr void Matrix34CalcCommon<T>::getTranslation(Vec3& v, const Base& n)
 {
     getBase(v, n, 3);
 }
@@ -1852,7 +1935,7 @@ void Matrix34CalcCommon<T>::getRotation(Vec3& v, const Base& n)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::scaleAllElements(Base& n, T s)
+constexpr void Matrix34CalcCommon<T>::scaleAllElements(Base& n, T s)
 {
     n.m[0][0] *= s;
     n.m[0][1] *= s;
@@ -1871,7 +1954,7 @@ void Matrix34CalcCommon<T>::scaleAllElements(Base& n, T s)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz)
+constexpr void Matrix34CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz)
 {
     n.m[0][0] *= sx;
     n.m[1][0] *= sx;
@@ -1887,7 +1970,7 @@ void Matrix34CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
+constexpr void Matrix34CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
 {
     n.m[0][axis] = v.x;
     n.m[1][axis] = v.y;
@@ -1895,7 +1978,7 @@ void Matrix34CalcCommon<T>::setBase(Base& n, s32 axis, const Vec3& v)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::setRow(Base& n, const Vec4& v, s32 row)
+constexpr void Matrix34CalcCommon<T>::setRow(Base& n, const Vec4& v, s32 row)
 {
     n.m[row][0] = v.x;
     n.m[row][1] = v.y;
@@ -1904,13 +1987,13 @@ void Matrix34CalcCommon<T>::setRow(Base& n, const Vec4& v, s32 row)
 }
 
 template <typename T>
-void Matrix34CalcCommon<T>::setTranslation(Base& n, const Vec3& v)
+constexpr void Matrix34CalcCommon<T>::setTranslation(Base& n, const Vec3& v)
 {
     setBase(n, 3, v);
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::makeIdentity(Base& o)
+constexpr void Matrix44CalcCommon<T>::makeIdentity(Base& o)
 {
     o.m[0][0] = 1;
     o.m[0][1] = 0;
@@ -1944,7 +2027,7 @@ inline void Matrix44CalcCommon<f32>::makeIdentity(Base& o)
 #endif  // cafe
 
 template <typename T>
-void Matrix44CalcCommon<T>::makeZero(Base& o)
+constexpr void Matrix44CalcCommon<T>::makeZero(Base& o)
 {
     o.m[0][0] = 0;
     o.m[0][1] = 0;
@@ -1968,7 +2051,7 @@ void Matrix44CalcCommon<T>::makeZero(Base& o)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::copy(Base& o, const Base& n)
+constexpr void Matrix44CalcCommon<T>::copy(Base& o, const Base& n)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -2002,7 +2085,7 @@ inline void Matrix44CalcCommon<f32>::copy(Base& o, const Base& n)
 #endif  // cafe
 
 template <typename T>
-void Matrix44CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t, const Vec4& v)
+constexpr void Matrix44CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t, const Vec4& v)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -2026,7 +2109,7 @@ void Matrix44CalcCommon<T>::copy(Base& o, const Mtx33& n, const Vec3& t, const V
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::copy(Base& o, const Mtx34& n, const Vec4& v)
+constexpr void Matrix44CalcCommon<T>::copy(Base& o, const Mtx34& n, const Vec4& v)
 {
     o.m[0][0] = n.m[0][0];
     o.m[0][1] = n.m[0][1];
@@ -2222,7 +2305,7 @@ void Matrix44CalcCommon<T>::inverseTranspose(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
+constexpr void Matrix44CalcCommon<T>::multiply(Base& o, const Base& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -2295,8 +2378,36 @@ inline void Matrix44CalcCommon<f32>::multiply(Base& o, const Base& a, const Base
 
 #endif  // cafe
 
+#ifdef SEAD_MATH_SIMD
+
+template <>
+inline void Matrix44CalcCommon<f32>::multiply(Base& o, const Base& a, const Base& b)
+{
+    using namespace detail;
+
+    const F32x4 b0 = simdLoad(b.m[0]);
+    const F32x4 b1 = simdLoad(b.m[1]);
+    const F32x4 b2 = simdLoad(b.m[2]);
+    const F32x4 b3 = simdLoad(b.m[3]);
+
+    F32x4 c[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        const F32x4 ai = simdLoad(a.m[i]);
+        c[i] = simdMul(simdSplatLane<0>(ai), b0);
+        c[i] = simdAdd(c[i], simdMul(simdSplatLane<1>(ai), b1));
+        c[i] = simdAdd(c[i], simdMul(simdSplatLane<2>(ai), b2));
+        c[i] = simdAdd(c[i], simdMul(simdSplatLane<3>(ai), b3));
+    }
+
+    for (int i = 0; i < 4; ++i)
+        simdStore(o.m[i], c[i]);
+}
+
+#endif  // SEAD_MATH_SIMD
+
 template <typename T>
-void Matrix44CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
+constexpr void Matrix44CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -2355,7 +2466,7 @@ void Matrix44CalcCommon<T>::multiply(Base& o, const Mtx34& a, const Base& b)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
+constexpr void Matrix44CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
 {
     const T a11 = a.m[0][0];
     const T a12 = a.m[0][1];
@@ -2414,7 +2525,7 @@ void Matrix44CalcCommon<T>::multiply(Base& o, const Base& a, const Mtx34& b)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::transpose(Base& o)
+constexpr void Matrix44CalcCommon<T>::transpose(Base& o)
 {
     const T a12 = o.m[0][1];
     const T a13 = o.m[0][2];
@@ -2476,7 +2587,7 @@ void Matrix44CalcCommon<T>::transposeTo(Base& o, const Base& n)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::makeQ(Base& o, const Quat& q)
+constexpr void Matrix44CalcCommon<T>::makeQ(Base& o, const Quat& q)
 {
     // Assuming the quaternion "q" is normalized
 
@@ -2685,7 +2796,7 @@ void Matrix44CalcCommon<T>::toQuat(Quat& q, const Base& n)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::getCol(Vec4& v, const Base& n, s32 axis)
+constexpr void Matrix44CalcCommon<T>::getCol(Vec4& v, const Base& n, s32 axis)
 {
     v.x = n.m[0][axis];
     v.y = n.m[1][axis];
@@ -2694,7 +2805,7 @@ void Matrix44CalcCommon<T>::getCol(Vec4& v, const Base& n, s32 axis)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
+constexpr void Matrix44CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
 {
     v.x = n.m[row][0];
     v.y = n.m[row][1];
@@ -2703,7 +2814,7 @@ void Matrix44CalcCommon<T>::getRow(Vec4& v, const Base& n, s32 row)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::scaleAllElements(Base& n, T s)
+constexpr void Matrix44CalcCommon<T>::scaleAllElements(Base& n, T s)
 {
     n.m[0][0] *= s;
     n.m[0][1] *= s;
@@ -2727,7 +2838,7 @@ void Matrix44CalcCommon<T>::scaleAllElements(Base& n, T s)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz, T sw)
+constexpr void Matrix44CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz, T sw)
 {
     n.m[0][0] *= sx;
     n.m[1][0] *= sx;
@@ -2751,7 +2862,7 @@ void Matrix44CalcCommon<T>::scaleBases(Base& n, T sx, T sy, T sz, T sw)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::setCol(Base& n, s32 axis, const Vec4& v)
+constexpr void Matrix44CalcCommon<T>::setCol(Base& n, s32 axis, const Vec4& v)
 {
     n.m[0][axis] = v.x;
     n.m[1][axis] = v.y;
@@ -2760,7 +2871,7 @@ void Matrix44CalcCommon<T>::setCol(Base& n, s32 axis, const Vec4& v)
 }
 
 template <typename T>
-void Matrix44CalcCommon<T>::setRow(Base& n, const Vec4& v, s32 row)
+constexpr void Matrix44CalcCommon<T>::setRow(Base& n, const Vec4& v, s32 row)
 {
     n.m[row][0] = v.x;
     n.m[row][1] = v.y;
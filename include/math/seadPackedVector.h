@@ -0,0 +1,158 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <gfx/seadColor.h>
+#include <math/seadVector.h>
+
+namespace sead
+{
+// Compact scalar types for storing and streaming vectors (vertex attributes, particles, network
+// data) at half or a quarter of the size of f32. They are storage types only: Vector2/3/4 of
+// them can be constructed, copied and compared bitwise, but all computations are done in f32
+// after unpacking with PackedVectorUtil.
+
+/// IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 mantissa bits. Range +-65504, about 3
+/// decimal digits. Conversions round to nearest even and preserve infinities and NaNs; values
+/// above the range become infinities.
+struct Float16
+{
+    static Float16 fromF32(f32 v);
+    f32 toF32() const;
+
+    u16 bits;
+};
+static_assert(sizeof(Float16) == 2);
+
+/// Signed normalized value: [-1, 1] mapped to [-32767, 32767]. Inputs are clamped to [-1, 1]
+/// and rounded to the nearest level; -32768 decodes to -1 as well.
+struct Snorm16
+{
+    static constexpr s32 cMax = 32767;
+
+    static Snorm16 fromF32(f32 v);
+    f32 toF32() const;
+
+    s16 value;
+};
+static_assert(sizeof(Snorm16) == 2);
+
+/// Unsigned normalized value: [0, 1] mapped to [0, 255]. Inputs are clamped to [0, 1] and
+/// rounded to the nearest level.
+struct Unorm8
+{
+    static constexpr u32 cMax = 255;
+
+    static Unorm8 fromF32(f32 v);
+    f32 toF32() const;
+
+    u8 value;
+};
+static_assert(sizeof(Unorm8) == 1);
+
+using Vector2h = Vector2<Float16>;
+using Vector3h = Vector3<Float16>;
+using Vector4h = Vector4<Float16>;
+
+using Vector2sn16 = Vector2<Snorm16>;
+using Vector3sn16 = Vector3<Snorm16>;
+using Vector4sn16 = Vector4<Snorm16>;
+
+using Vector2un8 = Vector2<Unorm8>;
+using Vector3un8 = Vector3<Unorm8>;
+using Vector4un8 = Vector4<Unorm8>;
+
+static_assert(sizeof(Vector3h) == 6 && sizeof(Vector4h) == 8);
+static_assert(sizeof(Vector3sn16) == 6 && sizeof(Vector4un8) == 4);
+
+/// Batch conversions between f32 data and the packed types.
+///
+/// The scalar kernels use F16C on x86 (when compiled with -mf16c) and NEON on AArch64, and are
+/// written so that the compiler can vectorize the other ones. The vector and colour overloads
+/// convert the components as one contiguous stream, so they run at the same speed.
+/// Color4f maps to Vector4 as (r, g, b, a) -> (x, y, z, w).
+class PackedVectorUtil
+{
+public:
+    static void pack(Float16* out, const f32* in, s32 n);
+    static void unpack(f32* out, const Float16* in, s32 n);
+    static void pack(Snorm16* out, const f32* in, s32 n);
+    static void unpack(f32* out, const Snorm16* in, s32 n);
+    static void pack(Unorm8* out, const f32* in, s32 n);
+    static void unpack(f32* out, const Unorm8* in, s32 n);
+
+    template <typename T>
+    static void pack(Vector2<T>* out, const Vector2f* in, s32 n)
+    {
+        pack(out->e.data(), in->e.data(), n * 2);
+    }
+
+    template <typename T>
+    static void unpack(Vector2f* out, const Vector2<T>* in, s32 n)
+    {
+        unpack(out->e.data(), in->e.data(), n * 2);
+    }
+
+    template <typename T>
+    static void pack(Vector3<T>* out, const Vector3f* in, s32 n)
+    {
+        pack(out->e.data(), in->e.data(), n * 3);
+    }
+
+    template <typename T>
+    static void unpack(Vector3f* out, const Vector3<T>* in, s32 n)
+    {
+        unpack(out->e.data(), in->e.data(), n * 3);
+    }
+
+    template <typename T>
+    static void pack(Vector4<T>* out, const Vector4f* in, s32 n)
+    {
+        pack(out->e.data(), in->e.data(), n * 4);
+    }
+
+    template <typename T>
+    static void unpack(Vector4f* out, const Vector4<T>* in, s32 n)
+    {
+        unpack(out->e.data(), in->e.data(), n * 4);
+    }
+
+    template <typename T>
+    static void pack(Vector4<T>* out, const Color4f* in, s32 n)
+    {
+        pack(out->e.data(), &in->r, n * 4);
+    }
+
+    template <typename T>
+    static void unpack(Color4f* out, const Vector4<T>* in, s32 n)
+    {
+        unpack(&out->r, in->e.data(), n * 4);
+    }
+
+    template <typename T>
+    static Vector3<T> pack(const Vector3f& v)
+    {
+        return {T::fromF32(v.x), T::fromF32(v.y), T::fromF32(v.z)};
+    }
+
+    template <typename T>
+    static Vector3f unpack(const Vector3<T>& v)
+    {
+        return {v.x.toF32(), v.y.toF32(), v.z.toF32()};
+    }
+
+    template <typename T>
+    static Vector4<T> pack(const Color4f& c)
+    {
+        return {T::fromF32(c.r), T::fromF32(c.g), T::fromF32(c.b), T::fromF32(c.a)};
+    }
+
+    template <typename T>
+    static Color4f unpackColor(const Vector4<T>& v)
+    {
+        return {v.x.toF32(), v.y.toF32(), v.z.toF32(), v.w.toF32()};
+    }
+};
+
+static_assert(sizeof(Color4f) == sizeof(f32) * 4);
+
+}  // namespace sead
@@ -17,9 +17,9 @@ private:
 public:
     Quat() {}
     Quat(const Quat& other) = default;
-    Quat(T w, T x, T y, T z);
+    constexpr Quat(T w, T x, T y, T z);
 
-    Quat& operator=(const Quat& other)
+    constexpr Quat& operator=(const Quat& other)
     {
         this->x = other.x;
         this->y = other.y;
@@ -28,7 +28,7 @@ public:
         return *this;
     }
 
-    Quat& operator+=(const Quat& other);
+    constexpr Quat& operator+=(const Quat& other);
     friend Quat operator+(const Quat& a, const Quat& b)
     {
         Quat o;
@@ -36,7 +36,7 @@ public:
         return o;
     }
 
-    Quat& operator-=(const Quat& other);
+    constexpr Quat& operator-=(const Quat& other);
     friend Quat operator-(const Quat& a, const Quat& b)
     {
         Quat o;
@@ -60,9 +60,9 @@ public:
 
     friend Quat operator*(T t, const Quat& q) { return operator*(q, t); }
 
-    Quat& operator*=(const Quat& t);
+    constexpr Quat& operator*=(const Quat& t);
 
-    Quat& operator*=(T t);
+    constexpr Quat& operator*=(T t);
 
     bool operator==(const Quat& rhs) const
     {
@@ -70,24 +70,25 @@ public:
     }
 
     T length() const;
-    T squaredLength() const;
+    constexpr T squaredLength() const;
     T normalize();
-    T dot(const Quat& q) const;
-    void inverse();
+    constexpr T dot(const Quat& q) const;
+    constexpr void inverse();
 
-    void makeUnit();
+    constexpr void makeUnit();
     bool makeVectorRotation(const Vec3& from, const Vec3& to);
-    void set(const Quat& other);
-    void set(T w, T x, T y, T z);
+    constexpr void set(const Quat& other);
+    constexpr void set(T w, T x, T y, T z);
     void setRPY(T roll, T pitch, T yaw);
     void setAxisAngle(const Vec3& axis, T angle);
     void setAxisRadian(const Vec3& axis, T radian);
-    void setAdd(const Quat& a, const Quat& b);
-    void setSub(const Quat& a, const Quat& b);
-    void setMul(const Quat& a, const Quat& b);
-    void setInverse(const Quat& q);
+    constexpr void setAdd(const Quat& a, const Quat& b);
+    constexpr void setSub(const Quat& a, const Quat& b);
+    constexpr void setMul(const Quat& a, const Quat& b);
+    constexpr void setInverse(const Quat& q);
     void calcRPY(Vec3& rpy) const;
     void slerpTo(const Quat& q1, const Quat& q2, f32 t);
+    void nlerpTo(const Quat& q1, const Quat& q2, f32 t);
 
     static const Quat unit;
 };
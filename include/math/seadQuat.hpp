@@ -8,34 +8,33 @@
 namespace sead
 {
 template <typename T>
-inline Quat<T>::Quat(T w_, T x_, T y_, T z_)
+constexpr Quat<T>::Quat(T w_, T x_, T y_, T z_) : Policies<T>::QuatBase{x_, y_, z_, w_}
 {
-    QuatCalcCommon<T>::set(*this, w_, x_, y_, z_);
 }
 
 template <typename T>
-inline Quat<T>& Quat<T>::operator+=(const Quat& other)
+constexpr Quat<T>& Quat<T>::operator+=(const Quat& other)
 {
     QuatCalcCommon<T>::add(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Quat<T>& Quat<T>::operator-=(const Quat& other)
+constexpr Quat<T>& Quat<T>::operator-=(const Quat& other)
 {
     QuatCalcCommon<T>::sub(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Quat<T>& Quat<T>::operator*=(const Quat& other)
+constexpr Quat<T>& Quat<T>::operator*=(const Quat& other)
 {
     QuatCalcCommon<T>::setMul(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Quat<T>& Quat<T>::operator*=(T t)
+constexpr Quat<T>& Quat<T>::operator*=(T t)
 {
     QuatCalcCommon<T>::setMulScalar(*this, *this, t);
     return *this;
@@ -48,7 +47,7 @@ inline T Quat<T>::length() const
 }
 
 template <typename T>
-inline T Quat<T>::squaredLength() const
+constexpr T Quat<T>::squaredLength() const
 {
     return QuatCalcCommon<T>::squaredLength(*this);
 }
@@ -60,19 +59,19 @@ inline T Quat<T>::normalize()
 }
 
 template <typename T>
-inline T Quat<T>::dot(const Quat& q) const
+constexpr T Quat<T>::dot(const Quat& q) const
 {
     return QuatCalcCommon<T>::dot(*this, q);
 }
 
 template <typename T>
-inline void Quat<T>::inverse()
+constexpr void Quat<T>::inverse()
 {
     QuatCalcCommon<T>::setInverse(*this, *this);
 }
 
 template <typename T>
-inline void Quat<T>::makeUnit()
+constexpr void Quat<T>::makeUnit()
 {
     QuatCalcCommon<T>::makeUnit(*this);
 }
@@ -84,13 +83,13 @@ inline bool Quat<T>::makeVectorRotation(const Vec3& from, const Vec3& to)
 }
 
 template <typename T>
-inline void Quat<T>::set(const Quat& other)
+constexpr void Quat<T>::set(const Quat& other)
 {
     QuatCalcCommon<T>::set(*this, other);
 }
 
 template <typename T>
-inline void Quat<T>::set(T w_, T x_, T y_, T z_)
+constexpr void Quat<T>::set(T w_, T x_, T y_, T z_)
 {
     QuatCalcCommon<T>::set(*this, w_, x_, y_, z_);
 }
@@ -114,25 +113,25 @@ inline void Quat<T>::setAxisRadian(const Vec3& axis, T radian)
 }
 
 template <typename T>
-inline void Quat<T>::setAdd(const Quat& a, const Quat& b)
+constexpr void Quat<T>::setAdd(const Quat& a, const Quat& b)
 {
     QuatCalcCommon<T>::add(*this, a, b);
 }
 
 template <typename T>
-inline void Quat<T>::setSub(const Quat& a, const Quat& b)
+constexpr void Quat<T>::setSub(const Quat& a, const Quat& b)
 {
     QuatCalcCommon<T>::sub(*this, a, b);
 }
 
 template <typename T>
-inline void Quat<T>::setMul(const Quat& a, const Quat& b)
+constexpr void Quat<T>::setMul(const Quat& a, const Quat& b)
 {
     QuatCalcCommon<T>::setMul(*this, a, b);
 }
 
 template <typename T>
-inline void Quat<T>::setInverse(const Quat& q)
+constexpr void Quat<T>::setInverse(const Quat& q)
 {
     QuatCalcCommon<T>::setInverse(*this, q);
 }
@@ -149,4 +148,10 @@ inline void Quat<T>::slerpTo(const Quat& q1, const Quat& q2, f32 t)
     QuatCalcCommon<T>::slerpTo(*this, q1, q2, t);
 }
 
+template <typename T>
+inline void Quat<T>::nlerpTo(const Quat& q1, const Quat& q2, f32 t)
+{
+    QuatCalcCommon<T>::nlerpTo(*this, q1, q2, t);
+}
+
 }  // namespace sead
@@ -13,20 +13,32 @@ public:
     using Vec3 = typename Policies<T>::Vec3Base;
 
     static T length(const Base& q);
-    static T squaredLength(const Base& q);
+    static constexpr T squaredLength(const Base& q);
     static T normalize(Base& q);
-    static T dot(const Base& u, const Base& v);
+    /// Normalizes `n` quaternions. Quaternions with a zero length are left unchanged.
+    static void normalize(Base* q, s32 n);
+    static constexpr T dot(const Base& u, const Base& v);
 
-    static void add(Base& out, const Base& u, const Base& v);
-    static void sub(Base& out, const Base& u, const Base& v);
-    static void setMul(Base& out, const Base& u, const Base& v);
-    static void setMulScalar(Base& out, const Base& q, T t);
-    static void setInverse(Base& out, const Base& q);
+    static constexpr void add(Base& out, const Base& u, const Base& v);
+    static constexpr void sub(Base& out, const Base& u, const Base& v);
+    static constexpr void setMul(Base& out, const Base& u, const Base& v);
+    static constexpr void setMulScalar(Base& out, const Base& q, T t);
+    static constexpr void setInverse(Base& out, const Base& q);
     static void slerpTo(Base& out, const Base& q1, const Base& q2, f32 t);
-    static void makeUnit(Base& q);
+    /// Interpolates `n` pairs of quaternions with the same factor.
+    /// `out` may be the same array as `q1` or `q2`.
+    static void slerpTo(Base* out, const Base* q1, const Base* q2, f32 t, s32 n);
+    /// Normalized linear interpolation along the shorter arc. Much cheaper than slerpTo, but the
+    /// angle does not change linearly with `t`: for unit quaternions up to 90 degrees apart, the
+    /// deviation from slerpTo is at most about 1.3 percent of the angle between them.
+    static void nlerpTo(Base& out, const Base& q1, const Base& q2, f32 t);
+    /// Interpolates `n` pairs of quaternions with the same factor.
+    /// `out` may be the same array as `q1` or `q2`.
+    static void nlerpTo(Base* out, const Base* q1, const Base* q2, f32 t, s32 n);
+    static constexpr void makeUnit(Base& q);
     static bool makeVectorRotation(Base& q, const Vec3& from, const Vec3& to);
-    static void set(Base& q, const Base& other);
-    static void set(Base& q, T w, T x, T y, T z);
+    static constexpr void set(Base& q, const Base& other);
+    static constexpr void set(Base& q, T w, T x, T y, T z);
     static void setRPY(Base& q, T roll, T pitch, T yaw);
     static void setAxisAngle(Base& q, const Vec3& axis, T angle);
     static void setAxisRadian(Base& q, const Vec3& axis, T angleRad);
@@ -17,7 +17,7 @@ inline T QuatCalcCommon<T>::length(const Base& q)
 }
 
 template <typename T>
-inline T QuatCalcCommon<T>::squaredLength(const Base& q)
+constexpr T QuatCalcCommon<T>::squaredLength(const Base& q)
 {
     return (q.w * q.w) + (q.x * q.x) + (q.y * q.y) + (q.z * q.z);
 }
@@ -39,13 +39,20 @@ inline T QuatCalcCommon<T>::normalize(Base& q)
 }
 
 template <typename T>
-inline T QuatCalcCommon<T>::dot(const Base& u, const Base& v)
+void QuatCalcCommon<T>::normalize(Base* q, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        normalize(q[i]);
+}
+
+template <typename T>
+constexpr T QuatCalcCommon<T>::dot(const Base& u, const Base& v)
 {
     return (u.w * v.w) + (u.x * v.x) + (u.y * v.y) + (u.z * v.z);
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::add(Base& out, const Base& u, const Base& v)
+constexpr void QuatCalcCommon<T>::add(Base& out, const Base& u, const Base& v)
 {
     out.w = u.w + v.w;
     out.x = u.x + v.x;
@@ -54,7 +61,7 @@ inline void QuatCalcCommon<T>::add(Base& out, const Base& u, const Base& v)
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::sub(Base& out, const Base& u, const Base& v)
+constexpr void QuatCalcCommon<T>::sub(Base& out, const Base& u, const Base& v)
 {
     out.w = u.w - v.w;
     out.x = u.x - v.x;
@@ -63,7 +70,7 @@ inline void QuatCalcCommon<T>::sub(Base& out, const Base& u, const Base& v)
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::setMul(Base& out, const Base& u, const Base& v)
+constexpr void QuatCalcCommon<T>::setMul(Base& out, const Base& u, const Base& v)
 {
     T w = (u.w * v.w) - (u.x * v.x) - (u.y * v.y) - (u.z * v.z);
     T x = (u.w * v.x) + (u.x * v.w) + (u.y * v.z) - (u.z * v.y);
@@ -76,7 +83,7 @@ inline void QuatCalcCommon<T>::setMul(Base& out, const Base& u, const Base& v)
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::setMulScalar(Base& out, const Base& q, T t)
+constexpr void QuatCalcCommon<T>::setMulScalar(Base& out, const Base& q, T t)
 {
     out.w = q.w * t;
     out.x = q.x * t;
@@ -85,7 +92,7 @@ inline void QuatCalcCommon<T>::setMulScalar(Base& out, const Base& q, T t)
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::setInverse(Base& out, const Base& q)
+constexpr void QuatCalcCommon<T>::setInverse(Base& out, const Base& q)
 {
     T prod = squaredLength(q);
     if (prod > std::numeric_limits<T>::epsilon())
@@ -144,7 +151,40 @@ inline void QuatCalcCommon<T>::slerpTo(Base& out, const Base& q1, const Base& q2
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::makeUnit(Base& q)
+void QuatCalcCommon<T>::slerpTo(Base* out, const Base* q1, const Base* q2, f32 t, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        slerpTo(out[i], q1[i], q2[i], t);
+}
+
+template <typename T>
+inline void QuatCalcCommon<T>::nlerpTo(Base& out, const Base& q1, const Base& q2, f32 t)
+{
+    // Both the sign flip and the normalization are computed without branches, so that the
+    // batched version can be vectorized.
+    const T a = 1 - t;
+    const T b = dot(q1, q2) < 0 ? -t : t;
+    const T x = a * q1.x + b * q2.x;
+    const T y = a * q1.y + b * q2.y;
+    const T z = a * q1.z + b * q2.z;
+    const T w = a * q1.w + b * q2.w;
+
+    const T inv_len = MathCalcCommon<T>::rsqrt(x * x + y * y + z * z + w * w);
+    out.x = x * inv_len;
+    out.y = y * inv_len;
+    out.z = z * inv_len;
+    out.w = w * inv_len;
+}
+
+template <typename T>
+void QuatCalcCommon<T>::nlerpTo(Base* out, const Base* q1, const Base* q2, f32 t, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        nlerpTo(out[i], q1[i], q2[i], t);
+}
+
+template <typename T>
+constexpr void QuatCalcCommon<T>::makeUnit(Base& q)
 {
     q = {0, 0, 0, 1};
 }
@@ -172,13 +212,13 @@ inline bool QuatCalcCommon<T>::makeVectorRotation(Base& q, const Vec3& from, con
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::set(Base& q, const Base& other)
+constexpr void QuatCalcCommon<T>::set(Base& q, const Base& other)
 {
     q = other;
 }
 
 template <typename T>
-inline void QuatCalcCommon<T>::set(Base& q, T w, T x, T y, T z)
+constexpr void QuatCalcCommon<T>::set(Base& q, T w, T x, T y, T z)
 {
     q.w = w;
     q.x = x;
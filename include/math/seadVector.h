@@ -15,11 +15,11 @@ struct Vector2 : public Policies<T>::Vec2Base
     /// @warning This constructor leaves member variables uninitialized.
     Vector2() {}
     Vector2(const Vector2& other) = default;
-    Vector2(T x, T y);
+    constexpr Vector2(T x, T y);
 
-    Vector2& operator=(const Vector2& other);
+    constexpr Vector2& operator=(const Vector2& other);
 
-    Vector2& operator+=(const Vector2& other);
+    constexpr Vector2& operator+=(const Vector2& other);
 
     friend Vector2 operator+(const Vector2& a, const Vector2& b)
     {
@@ -28,7 +28,7 @@ struct Vector2 : public Policies<T>::Vec2Base
         return o;
     }
 
-    Vector2& operator-=(const Vector2& other);
+    constexpr Vector2& operator-=(const Vector2& other);
 
     friend Vector2 operator-(const Vector2& a, const Vector2& b)
     {
@@ -37,7 +37,7 @@ struct Vector2 : public Policies<T>::Vec2Base
         return o;
     }
 
-    Vector2& operator*=(T t);
+    constexpr Vector2& operator*=(T t);
 
     friend Vector2 operator*(const Vector2& a, T t)
     {
@@ -48,24 +48,24 @@ struct Vector2 : public Policies<T>::Vec2Base
 
     friend Vector2 operator*(T t, const Vector2& a) { return operator*(a, t); }
 
-    Vector2& operator/=(T t);
+    constexpr Vector2& operator/=(T t);
 
     friend Vector2 operator/(const Vector2& a, T t) { return {a.x / t, a.y / t}; }
 
     bool operator==(const Vector2& rhs) const { return this->x == rhs.x && this->y == rhs.y; }
     bool operator!=(const Vector2& rhs) const { return !operator==(rhs); }
 
-    void multScalar(T t);
-    void negate();
-    void set(const Vector2& other);
-    void set(T x_, T y_);
-    void setAdd(const Vector2<T>& a, const Vector2<T>& b);
-    void setScale(const Vector2<T>& a, T t);
+    constexpr void multScalar(T t);
+    constexpr void negate();
+    constexpr void set(const Vector2& other);
+    constexpr void set(T x_, T y_);
+    constexpr void setAdd(const Vector2<T>& a, const Vector2<T>& b);
+    constexpr void setScale(const Vector2<T>& a, T t);
 
-    T dot(const Vector2& other) const;
-    T cross(const Vector2& other) const;
+    constexpr T dot(const Vector2& other) const;
+    constexpr T cross(const Vector2& other) const;
     T length() const;
-    T squaredLength() const;
+    constexpr T squaredLength() const;
     T normalize();
 
     bool isZero() const { return *this == zero; }
@@ -87,13 +87,13 @@ struct Vector3 : public Policies<T>::Vec3Base
     /// @warning This constructor leaves member variables uninitialized.
     Vector3() {}
     Vector3(const Vector3& other) = default;
-    Vector3(T x, T y, T z);
+    constexpr Vector3(T x, T y, T z);
 
-    Vector3& operator=(const Vector3& other);
-    bool operator==(const Vector3& rhs) const;
-    bool operator!=(const Vector3& rhs) const;
+    constexpr Vector3& operator=(const Vector3& other);
+    constexpr bool operator==(const Vector3& rhs) const;
+    constexpr bool operator!=(const Vector3& rhs) const;
 
-    Vector3& operator+=(const Vector3& other);
+    constexpr Vector3& operator+=(const Vector3& other);
     friend Vector3 operator+(const Vector3& a, const Vector3& b)
     {
         Vector3 o;
@@ -101,7 +101,7 @@ struct Vector3 : public Policies<T>::Vec3Base
         return o;
     }
 
-    Vector3& operator-=(const Vector3& other);
+    constexpr Vector3& operator-=(const Vector3& other);
     friend Vector3 operator-(const Vector3& a, const Vector3& b)
     {
         Vector3 o;
@@ -109,7 +109,7 @@ struct Vector3 : public Policies<T>::Vec3Base
         return o;
     }
 
-    Vector3& operator*=(T t);
+    constexpr Vector3& operator*=(T t);
     Vector3& operator*=(const Mtx33& m);
     Vector3& operator*=(const Mtx34& m);
     Vector3& operator*=(const Mtx44& m);
@@ -139,7 +139,7 @@ struct Vector3 : public Policies<T>::Vec3Base
         return o;
     }
 
-    Vector3& operator/=(T t);
+    constexpr Vector3& operator/=(T t);
     friend Vector3 operator/(const Vector3& a, T t) { return {a.x / t, a.y / t, a.z / t}; }
 
     Vector3 operator-() const { return {-this->x, -this->y, -this->z}; }
@@ -151,15 +151,15 @@ struct Vector3 : public Policies<T>::Vec3Base
         return o;
     }
 
-    T dot(const Vector3& t) const;
+    constexpr T dot(const Vector3& t) const;
     T length() const;
-    T squaredLength() const;
+    constexpr T squaredLength() const;
 
     /// Checks if the differences of all components of lhs and rhs are within `epsilon`.
     /// (i.e. -epsilon <= lhs.x - rhs.x <= epsilon, and so on).
     bool equals(const Vector3& rhs, T epsilon = 0) const;
 
-    void add(const Vector3& a);
+    constexpr void add(const Vector3& a);
     /// Apply a rotation `m` to this vector.
     void mul(const Mtx33& m);
     /// Apply a transformation `m` (rotation then translation) to this vector.
@@ -172,23 +172,23 @@ struct Vector3 : public Policies<T>::Vec3Base
     void rotate(const Mtx34& m);
     /// Apply a rotation `q` to this vector.
     void rotate(const Quat& q);
-    void multScalar(T t);
+    constexpr void multScalar(T t);
 
     T normalize();
-    void negate();
-    void set(const Vector3& other);
-    void set(T x, T y, T z);
-    void setAdd(const Vector3<T>& a, const Vector3<T>& b);
-    void setCross(const Vector3<T>& a, const Vector3<T>& b);
-    void setScale(const Vector3<T>& a, T t);
-    void setScaleAdd(T t, const Vector3<T>& a, const Vector3<T>& b);
-    void setMul(const Mtx33& m, const Vector3& a);
-    void setMul(const Mtx34& m, const Vector3& a);
-    void setMul(const Mtx44& m, const Vector3& a);
-    void setRotated(const Mtx33& m, const Vector3& a);
-    void setRotated(const Mtx34& m, const Vector3& a);
-    void setRotated(const Quat& q, const Vector3& a);
-    void setSub(const Vector3& a, const Vector3& b);
+    constexpr void negate();
+    constexpr void set(const Vector3& other);
+    constexpr void set(T x, T y, T z);
+    constexpr void setAdd(const Vector3<T>& a, const Vector3<T>& b);
+    constexpr void setCross(const Vector3<T>& a, const Vector3<T>& b);
+    constexpr void setScale(const Vector3<T>& a, T t);
+    constexpr void setScaleAdd(T t, const Vector3<T>& a, const Vector3<T>& b);
+    constexpr void setMul(const Mtx33& m, const Vector3& a);
+    constexpr void setMul(const Mtx34& m, const Vector3& a);
+    constexpr void setMul(const Mtx44& m, const Vector3& a);
+    constexpr void setRotated(const Mtx33& m, const Vector3& a);
+    constexpr void setRotated(const Mtx34& m, const Vector3& a);
+    constexpr void setRotated(const Quat& q, const Vector3& a);
+    constexpr void setSub(const Vector3& a, const Vector3& b);
 
     static const Vector3 zero;
     static const Vector3 ex;
@@ -203,31 +203,31 @@ struct Vector4 : public Policies<T>::Vec4Base
     /// @warning This constructor leaves member variables uninitialized.
     Vector4() {}
     Vector4(const Vector4& other) = default;
-    Vector4(T x, T y, T z, T w);
+    constexpr Vector4(T x, T y, T z, T w);
 
-    Vector4& operator=(const Vector4& other);
+    constexpr Vector4& operator=(const Vector4& other);
 
-    Vector4& operator+=(const Vector4& other);
+    constexpr Vector4& operator+=(const Vector4& other);
 
     friend Vector4 operator+(const Vector4& a, const Vector4& b)
     {
         return {a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w};
     }
 
-    Vector4& operator-=(const Vector4& other);
+    constexpr Vector4& operator-=(const Vector4& other);
 
     friend Vector4 operator-(const Vector4& a, const Vector4& b)
     {
         return {a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w};
     }
 
-    Vector4& operator*=(T t);
+    constexpr Vector4& operator*=(T t);
 
     friend Vector4 operator*(const Vector4& a, T t) { return {a.x * t, a.y * t, a.z * t, a.w * t}; }
 
     friend Vector4 operator*(T t, const Vector4& a) { return operator*(a, t); }
 
-    Vector4& operator/=(T t);
+    constexpr Vector4& operator/=(T t);
 
     friend Vector4 operator/(const Vector4& a, T t) { return {a.x / t, a.y / t, a.z / t, a.w / t}; }
 
@@ -238,11 +238,11 @@ struct Vector4 : public Policies<T>::Vec4Base
     bool operator!=(const Vector4& rhs) const { return !operator==(rhs); }
 
     T normalize();
-    void negate();
+    constexpr void negate();
     T length() const;
-    T squaredLength() const;
-    void set(const Vector4& v);
-    void set(T x_, T y_, T z_, T w_);
+    constexpr T squaredLength() const;
+    constexpr void set(const Vector4& v);
+    constexpr void set(T x_, T y_, T z_, T w_);
 
     static const Vector4 zero;
     static const Vector4 ex;
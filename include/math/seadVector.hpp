@@ -8,27 +8,26 @@
 namespace sead
 {
 template <typename T>
-inline Vector2<T>::Vector2(T x_, T y_)
+constexpr Vector2<T>::Vector2(T x_, T y_) : Policies<T>::Vec2Base{{{x_, y_}}}
 {
-    Vector2CalcCommon<T>::set(*this, x_, y_);
 }
 
 template <typename T>
-inline Vector2<T>& Vector2<T>::operator+=(const Vector2<T>& other)
+constexpr Vector2<T>& Vector2<T>::operator+=(const Vector2<T>& other)
 {
     Vector2CalcCommon<T>::add(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Vector2<T>& Vector2<T>::operator-=(const Vector2<T>& other)
+constexpr Vector2<T>& Vector2<T>::operator-=(const Vector2<T>& other)
 {
     Vector2CalcCommon<T>::sub(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Vector2<T>& Vector2<T>::operator*=(T t)
+constexpr Vector2<T>& Vector2<T>::operator*=(T t)
 {
     this->x *= t;
     this->y *= t;
@@ -36,7 +35,7 @@ inline Vector2<T>& Vector2<T>::operator*=(T t)
 }
 
 template <typename T>
-inline Vector2<T>& Vector2<T>::operator/=(T t)
+constexpr Vector2<T>& Vector2<T>::operator/=(T t)
 {
     this->x /= t;
     this->y /= t;
@@ -44,7 +43,7 @@ inline Vector2<T>& Vector2<T>::operator/=(T t)
 }
 
 template <typename T>
-inline Vector2<T>& Vector2<T>::operator=(const Vector2<T>& other)
+constexpr Vector2<T>& Vector2<T>::operator=(const Vector2<T>& other)
 {
     this->x = other.x;
     this->y = other.y;
@@ -52,49 +51,49 @@ inline Vector2<T>& Vector2<T>::operator=(const Vector2<T>& other)
 }
 
 template <typename T>
-inline void Vector2<T>::negate()
+constexpr void Vector2<T>::negate()
 {
     Vector2CalcCommon<T>::negate(*this);
 }
 
 template <typename T>
-inline void Vector2<T>::multScalar(T t)
+constexpr void Vector2<T>::multScalar(T t)
 {
     Vector2CalcCommon<T>::multScalar(*this, *this, t);
 }
 
 template <typename T>
-inline void Vector2<T>::set(const Vector2<T>& other)
+constexpr void Vector2<T>::set(const Vector2<T>& other)
 {
     Vector2CalcCommon<T>::set(*this, other);
 }
 
 template <typename T>
-inline void Vector2<T>::set(T x_, T y_)
+constexpr void Vector2<T>::set(T x_, T y_)
 {
     Vector2CalcCommon<T>::set(*this, x_, y_);
 }
 
 template <typename T>
-inline void Vector2<T>::setAdd(const Vector2<T>& a, const Vector2<T>& b)
+constexpr void Vector2<T>::setAdd(const Vector2<T>& a, const Vector2<T>& b)
 {
     Vector2CalcCommon<T>::add(*this, a, b);
 }
 
 template <typename T>
-inline void Vector2<T>::setScale(const Vector2<T>& a, T t)
+constexpr void Vector2<T>::setScale(const Vector2<T>& a, T t)
 {
     Vector2CalcCommon<T>::multScalar(*this, a, t);
 }
 
 template <typename T>
-inline T Vector2<T>::dot(const Vector2<T>& t) const
+constexpr T Vector2<T>::dot(const Vector2<T>& t) const
 {
     return Vector2CalcCommon<T>::dot(*this, t);
 }
 
 template <typename T>
-inline T Vector2<T>::cross(const Vector2<T>& t) const
+constexpr T Vector2<T>::cross(const Vector2<T>& t) const
 {
     return Vector2CalcCommon<T>::cross(*this, t);
 }
@@ -106,7 +105,7 @@ inline T Vector2<T>::length() const
 }
 
 template <typename T>
-inline T Vector2<T>::squaredLength() const
+constexpr T Vector2<T>::squaredLength() const
 {
     return Vector2CalcCommon<T>::squaredLength(*this);
 }
@@ -118,13 +117,12 @@ inline T Vector2<T>::normalize()
 }
 
 template <typename T>
-inline Vector3<T>::Vector3(T x_, T y_, T z_)
+constexpr Vector3<T>::Vector3(T x_, T y_, T z_) : Policies<T>::Vec3Base{{{x_, y_, z_}}}
 {
-    Vector3CalcCommon<T>::set(*this, x_, y_, z_);
 }
 
 template <typename T>
-inline Vector3<T>& Vector3<T>::operator=(const Vector3<T>& other)
+constexpr Vector3<T>& Vector3<T>::operator=(const Vector3<T>& other)
 {
     this->x = other.x;
     this->y = other.y;
@@ -133,33 +131,33 @@ inline Vector3<T>& Vector3<T>::operator=(const Vector3<T>& other)
 }
 
 template <typename T>
-inline bool Vector3<T>::operator==(const Vector3& rhs) const
+constexpr bool Vector3<T>::operator==(const Vector3& rhs) const
 {
     return this->x == rhs.x && this->y == rhs.y && this->z == rhs.z;
 }
 
 template <typename T>
-inline bool Vector3<T>::operator!=(const Vector3& rhs) const
+constexpr bool Vector3<T>::operator!=(const Vector3& rhs) const
 {
     return !operator==(rhs);
 }
 
 template <typename T>
-inline Vector3<T>& Vector3<T>::operator+=(const Vector3<T>& other)
+constexpr Vector3<T>& Vector3<T>::operator+=(const Vector3<T>& other)
 {
     Vector3CalcCommon<T>::add(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Vector3<T>& Vector3<T>::operator-=(const Vector3<T>& other)
+constexpr Vector3<T>& Vector3<T>::operator-=(const Vector3<T>& other)
 {
     Vector3CalcCommon<T>::sub(*this, *this, other);
     return *this;
 }
 
 template <typename T>
-inline Vector3<T>& Vector3<T>::operator*=(T t)
+constexpr Vector3<T>& Vector3<T>::operator*=(T t)
 {
     Vector3CalcCommon<T>::multScalar(*this, *this, t);
     return *this;
@@ -187,7 +185,7 @@ inline Vector3<T>& Vector3<T>::operator*=(const Mtx44& m)
 }
 
 template <typename T>
-inline Vector3<T>& Vector3<T>::operator/=(T t)
+constexpr Vector3<T>& Vector3<T>::operator/=(T t)
 {
     this->x /= t;
     this->y /= t;
@@ -196,7 +194,7 @@ inline Vector3<T>& Vector3<T>::operator/=(T t)
 }
 
 template <typename T>
-inline T Vector3<T>::dot(const Vector3<T>& t) const
+constexpr T Vector3<T>::dot(const Vector3<T>& t) const
 {
     return Vector3CalcCommon<T>::dot(*this, t);
 }
@@ -208,7 +206,7 @@ inline T Vector3<T>::length() const
 }
 
 template <typename T>
-inline T Vector3<T>::squaredLength() const
+constexpr T Vector3<T>::squaredLength() const
 {
     return Vector3CalcCommon<T>::squaredLength(*this);
 }
@@ -220,7 +218,7 @@ inline bool Vector3<T>::equals(const Vector3<T>& rhs, T epsilon) const
 }
 
 template <typename T>
-inline void Vector3<T>::add(const Vector3<T>& a)
+constexpr void Vector3<T>::add(const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::add(*this, *this, a);
 }
@@ -262,7 +260,7 @@ inline void Vector3<T>::rotate(const Quat& q)
 }
 
 template <typename T>
-inline void Vector3<T>::multScalar(T t)
+constexpr void Vector3<T>::multScalar(T t)
 {
     Vector3CalcCommon<T>::multScalar(*this, *this, t);
 }
@@ -274,97 +272,96 @@ inline T Vector3<T>::normalize()
 }
 
 template <typename T>
-inline void Vector3<T>::negate()
+constexpr void Vector3<T>::negate()
 {
     Vector3CalcCommon<T>::negate(*this);
 }
 
 template <typename T>
-inline void Vector3<T>::set(const Vector3<T>& other)
+constexpr void Vector3<T>::set(const Vector3<T>& other)
 {
     Vector3CalcCommon<T>::set(*this, other);
 }
 
 template <typename T>
-inline void Vector3<T>::set(T x_, T y_, T z_)
+constexpr void Vector3<T>::set(T x_, T y_, T z_)
 {
     Vector3CalcCommon<T>::set(*this, x_, y_, z_);
 }
 
 template <typename T>
-inline void Vector3<T>::setAdd(const Vector3<T>& a, const Vector3<T>& b)
+constexpr void Vector3<T>::setAdd(const Vector3<T>& a, const Vector3<T>& b)
 {
     Vector3CalcCommon<T>::add(*this, a, b);
 }
 
 template <typename T>
-inline void Vector3<T>::setCross(const Vector3<T>& a, const Vector3<T>& b)
+constexpr void Vector3<T>::setCross(const Vector3<T>& a, const Vector3<T>& b)
 {
     Vector3CalcCommon<T>::cross(*this, a, b);
 }
 
 template <typename T>
-inline void Vector3<T>::setScale(const Vector3<T>& a, T t)
+constexpr void Vector3<T>::setScale(const Vector3<T>& a, T t)
 {
     Vector3CalcCommon<T>::multScalar(*this, a, t);
 }
 
 template <typename T>
-inline void Vector3<T>::setScaleAdd(T t, const Vector3<T>& a, const Vector3<T>& b)
+constexpr void Vector3<T>::setScaleAdd(T t, const Vector3<T>& a, const Vector3<T>& b)
 {
     Vector3CalcCommon<T>::multScalarAdd(*this, t, a, b);
 }
 
 template <typename T>
-inline void Vector3<T>::setMul(const Mtx33& m, const Vector3<T>& a)
+constexpr void Vector3<T>::setMul(const Mtx33& m, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::mul(*this, m, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setMul(const Mtx34& m, const Vector3<T>& a)
+constexpr void Vector3<T>::setMul(const Mtx34& m, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::mul(*this, m, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setMul(const Mtx44& m, const Vector3<T>& a)
+constexpr void Vector3<T>::setMul(const Mtx44& m, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::mul(*this, m, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setRotated(const Mtx33& m, const Vector3<T>& a)
+constexpr void Vector3<T>::setRotated(const Mtx33& m, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::rotate(*this, m, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setRotated(const Mtx34& m, const Vector3<T>& a)
+constexpr void Vector3<T>::setRotated(const Mtx34& m, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::rotate(*this, m, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setRotated(const Quat& q, const Vector3<T>& a)
+constexpr void Vector3<T>::setRotated(const Quat& q, const Vector3<T>& a)
 {
     Vector3CalcCommon<T>::rotate(*this, q, a);
 }
 
 template <typename T>
-inline void Vector3<T>::setSub(const Vector3<T>& a, const Vector3<T>& b)
+constexpr void Vector3<T>::setSub(const Vector3<T>& a, const Vector3<T>& b)
 {
     Vector3CalcCommon<T>::sub(*this, a, b);
 }
 
 template <typename T>
-inline Vector4<T>::Vector4(T x_, T y_, T z_, T w_)
+constexpr Vector4<T>::Vector4(T x_, T y_, T z_, T w_) : Policies<T>::Vec4Base{{{x_, y_, z_, w_}}}
 {
-    Vector4CalcCommon<T>::set(*this, x_, y_, z_, w_);
 }
 
 template <typename T>
-inline Vector4<T>& Vector4<T>::operator+=(const Vector4<T>& other)
+constexpr Vector4<T>& Vector4<T>::operator+=(const Vector4<T>& other)
 {
     this->x += other.x;
     this->y += other.y;
@@ -374,7 +371,7 @@ inline Vector4<T>& Vector4<T>::operator+=(const Vector4<T>& other)
 }
 
 template <typename T>
-inline Vector4<T>& Vector4<T>::operator-=(const Vector4<T>& other)
+constexpr Vector4<T>& Vector4<T>::operator-=(const Vector4<T>& other)
 {
     this->x -= other.x;
     this->y -= other.y;
@@ -384,7 +381,7 @@ inline Vector4<T>& Vector4<T>::operator-=(const Vector4<T>& other)
 }
 
 template <typename T>
-inline Vector4<T>& Vector4<T>::operator*=(T t)
+constexpr Vector4<T>& Vector4<T>::operator*=(T t)
 {
     this->x *= t;
     this->y *= t;
@@ -394,7 +391,7 @@ inline Vector4<T>& Vector4<T>::operator*=(T t)
 }
 
 template <typename T>
-inline Vector4<T>& Vector4<T>::operator/=(T t)
+constexpr Vector4<T>& Vector4<T>::operator/=(T t)
 {
     this->x /= t;
     this->y /= t;
@@ -404,7 +401,7 @@ inline Vector4<T>& Vector4<T>::operator/=(T t)
 }
 
 template <typename T>
-inline Vector4<T>& Vector4<T>::operator=(const Vector4<T>& other)
+constexpr Vector4<T>& Vector4<T>::operator=(const Vector4<T>& other)
 {
     this->x = other.x;
     this->y = other.y;
@@ -420,7 +417,7 @@ inline T Vector4<T>::normalize()
 }
 
 template <typename T>
-inline void Vector4<T>::negate()
+constexpr void Vector4<T>::negate()
 {
     Vector4CalcCommon<T>::negate(*this);
 }
@@ -432,19 +429,19 @@ inline T Vector4<T>::length() const
 }
 
 template <typename T>
-inline T Vector4<T>::squaredLength() const
+constexpr T Vector4<T>::squaredLength() const
 {
     return Vector4CalcCommon<T>::squaredLength(*this);
 }
 
 template <typename T>
-inline void Vector4<T>::set(const Vector4<T>& other)
+constexpr void Vector4<T>::set(const Vector4<T>& other)
 {
     Vector4CalcCommon<T>::set(*this, other);
 }
 
 template <typename T>
-inline void Vector4<T>::set(T x_, T y_, T z_, T w_)
+constexpr void Vector4<T>::set(T x_, T y_, T z_, T w_)
 {
     Vector4CalcCommon<T>::set(*this, x_, y_, z_, w_);
 }
@@ -11,17 +11,17 @@ public:
     using Base = typename Policies<T>::Vec2Base;
 
 public:
-    static void add(Base& o, const Base& a, const Base& b);
-    static void sub(Base& o, const Base& a, const Base& b);
-    static void multScalar(Base& o, const Base& v, T t);
+    static constexpr void add(Base& o, const Base& a, const Base& b);
+    static constexpr void sub(Base& o, const Base& a, const Base& b);
+    static constexpr void multScalar(Base& o, const Base& v, T t);
 
-    static void negate(Base& v);
-    static void set(Base& o, const Base& v);
-    static void set(Base& v, T x, T y);
+    static constexpr void negate(Base& v);
+    static constexpr void set(Base& o, const Base& v);
+    static constexpr void set(Base& v, T x, T y);
 
-    static T dot(const Base& a, const Base& b);
-    static T cross(const Base& a, const Base& b);
-    static T squaredLength(const Base& v);
+    static constexpr T dot(const Base& a, const Base& b);
+    static constexpr T cross(const Base& a, const Base& b);
+    static constexpr T squaredLength(const Base& v);
     static T length(const Base& v);
     static T normalize(Base& v);
 };
@@ -36,33 +36,38 @@ public:
     using Mtx44 = typename Policies<T>::Mtx44Base;
     using Quat = typename Policies<T>::QuatBase;
 
-    static void add(Base& o, const Base& a, const Base& b);
-    static void sub(Base& o, const Base& a, const Base& b);
+    static constexpr void add(Base& o, const Base& a, const Base& b);
+    static constexpr void sub(Base& o, const Base& a, const Base& b);
     /// Apply a rotation `m` to the vector `a`.
-    static void mul(Base& o, const Mtx33& m, const Base& a);
+    static constexpr void mul(Base& o, const Mtx33& m, const Base& a);
     /// Apply a transformation `m` (rotation then translation) to the vector `a`.
-    static void mul(Base& o, const Mtx34& m, const Base& a);
+    static constexpr void mul(Base& o, const Mtx34& m, const Base& a);
     /// Apply a transformation `m` (rotation, translation, homogenous coord) to the vector `a`.
-    static void mul(Base& o, const Mtx44& m, const Base& a);
+    static constexpr void mul(Base& o, const Mtx44& m, const Base& a);
 
     /// Apply a rotation `m` to the vector `a`.
-    static void rotate(Base& o, const Mtx33& m, const Base& a);
+    static constexpr void rotate(Base& o, const Mtx33& m, const Base& a);
     /// Apply a rotation `m` to the vector `a`.
-    static void rotate(Base& o, const Mtx34& m, const Base& a);
+    static constexpr void rotate(Base& o, const Mtx34& m, const Base& a);
     /// Apply a rotation 'q' to the vector 'a'
-    static void rotate(Base& o, const Quat& q, const Base& a);
+    static constexpr void rotate(Base& o, const Quat& q, const Base& a);
 
-    static void cross(Base& o, const Base& a, const Base& b);
-    static T dot(const Base& a, const Base& b);
-    static T squaredLength(const Base& v);
+    /// Apply a transformation `m` to `n` vectors. `o` may be the same array as `a`.
+    static void transformPoints(Base* o, const Base* a, s32 n, const Mtx34& m);
+    /// Apply the rotation part of `m` to `n` vectors. `o` may be the same array as `a`.
+    static void transformDirections(Base* o, const Base* a, s32 n, const Mtx34& m);
+
+    static constexpr void cross(Base& o, const Base& a, const Base& b);
+    static constexpr T dot(const Base& a, const Base& b);
+    static constexpr T squaredLength(const Base& v);
     static T length(const Base& v);
     static bool equals(const Base& lhs, const Base& rhs, T epsilon);
-    static void multScalar(Base& o, const Base& v, T t);
-    static void multScalarAdd(Base& o, T t, const Base& a, const Base& b);
+    static constexpr void multScalar(Base& o, const Base& v, T t);
+    static constexpr void multScalarAdd(Base& o, T t, const Base& a, const Base& b);
     static T normalize(Base& v);
-    static void negate(Base& v);
-    static void set(Base& o, const Base& v);
-    static void set(Base& v, T x, T y, T z);
+    static constexpr void negate(Base& v);
+    static constexpr void set(Base& o, const Base& v);
+    static constexpr void set(Base& v, T x, T y, T z);
 };
 
 template <typename T>
@@ -73,11 +78,11 @@ public:
 
 public:
     static T normalize(Base& v);
-    static void negate(Base& v);
-    static T squaredLength(const Base& v);
+    static constexpr void negate(Base& v);
+    static constexpr T squaredLength(const Base& v);
     static T length(const Base& v);
-    static void set(Base& o, const Base& v);
-    static void set(Base& v, T x, T y, T z, T w);
+    static constexpr void set(Base& o, const Base& v);
+    static constexpr void set(Base& v, T x, T y, T z, T w);
 };
 
 }  // namespace sead
@@ -5,6 +5,7 @@
 #endif  // cafe
 
 #include <math/seadMathCalcCommon.h>
+#include <math/seadMathSimd.h>
 #include <math/seadQuatCalcCommon.h>
 #ifndef SEAD_MATH_VECTOR_CALC_COMMON_H_
 #include <math/seadVectorCalcCommon.h>
@@ -13,59 +14,59 @@
 namespace sead
 {
 template <typename T>
-inline void Vector2CalcCommon<T>::add(Base& o, const Base& a, const Base& b)
+constexpr void Vector2CalcCommon<T>::add(Base& o, const Base& a, const Base& b)
 {
     o.x = a.x + b.x;
     o.y = a.y + b.y;
 }
 
 template <typename T>
-inline void Vector2CalcCommon<T>::multScalar(Base& o, const Base& v, T t)
+constexpr void Vector2CalcCommon<T>::multScalar(Base& o, const Base& v, T t)
 {
     o.x = v.x * t;
     o.y = v.y * t;
 }
 
 template <typename T>
-inline void Vector2CalcCommon<T>::sub(Base& o, const Base& a, const Base& b)
+constexpr void Vector2CalcCommon<T>::sub(Base& o, const Base& a, const Base& b)
 {
     o.x = a.x - b.x;
     o.y = a.y - b.y;
 }
 
 template <typename T>
-inline void Vector2CalcCommon<T>::negate(Base& v)
+constexpr void Vector2CalcCommon<T>::negate(Base& v)
 {
     v.x = -v.x;
     v.y = -v.y;
 }
 template <typename T>
-inline void Vector2CalcCommon<T>::set(Base& o, const Base& v)
+constexpr void Vector2CalcCommon<T>::set(Base& o, const Base& v)
 {
     o = v;
 }
 
 template <typename T>
-inline void Vector2CalcCommon<T>::set(Base& v, T x, T y)
+constexpr void Vector2CalcCommon<T>::set(Base& v, T x, T y)
 {
     v.x = x;
     v.y = y;
 }
 
 template <typename T>
-inline T Vector2CalcCommon<T>::dot(const Base& a, const Base& b)
+constexpr T Vector2CalcCommon<T>::dot(const Base& a, const Base& b)
 {
     return a.x * b.x + a.y * b.y;
 }
 
 template <typename T>
-inline T Vector2CalcCommon<T>::cross(const Base& a, const Base& b)
+constexpr T Vector2CalcCommon<T>::cross(const Base& a, const Base& b)
 {
     return a.x * b.y - a.y * b.x;
 }
 
 template <typename T>
-inline T Vector2CalcCommon<T>::squaredLength(const Base& v)
+constexpr T Vector2CalcCommon<T>::squaredLength(const Base& v)
 {
     return v.x * v.x + v.y * v.y;
 }
@@ -91,7 +92,7 @@ T Vector2CalcCommon<T>::normalize(Base& v)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::add(Base& o, const Base& a, const Base& b)
+constexpr void Vector3CalcCommon<T>::add(Base& o, const Base& a, const Base& b)
 {
     o.x = a.x + b.x;
     o.y = a.y + b.y;
@@ -110,7 +111,7 @@ inline void Vector3CalcCommon<f32>::add(Base& o, const Base& a, const Base& b)
 #endif  // cafe
 
 template <typename T>
-inline void Vector3CalcCommon<T>::sub(Base& o, const Base& a, const Base& b)
+constexpr void Vector3CalcCommon<T>::sub(Base& o, const Base& a, const Base& b)
 {
     o.x = a.x - b.x;
     o.y = a.y - b.y;
@@ -129,7 +130,7 @@ inline void Vector3CalcCommon<f32>::sub(Base& o, const Base& a, const Base& b)
 #endif  // cafe
 
 template <typename T>
-inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx33& m, const Base& a)
+constexpr void Vector3CalcCommon<T>::mul(Base& o, const Mtx33& m, const Base& a)
 {
     const Base tmp = a;
     o.x = m.m[0][0] * tmp.x + m.m[0][1] * tmp.y + m.m[0][2] * tmp.z;
@@ -138,7 +139,7 @@ inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx33& m, const Base& a)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx34& m, const Base& a)
+constexpr void Vector3CalcCommon<T>::mul(Base& o, const Mtx34& m, const Base& a)
 {
     const Base tmp = a;
     o.x = m.m[0][0] * tmp.x + m.m[0][1] * tmp.y + m.m[0][2] * tmp.z + m.m[0][3];
@@ -146,8 +147,30 @@ inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx34& m, const Base& a)
     o.z = m.m[2][0] * tmp.x + m.m[2][1] * tmp.y + m.m[2][2] * tmp.z + m.m[2][3];
 }
 
+#ifdef SEAD_MATH_SIMD
+
+template <>
+inline void Vector3CalcCommon<f32>::mul(Base& o, const Mtx34& m, const Base& a)
+{
+    using namespace detail;
+
+    F32x4 c0 = simdLoad(m.m[0]);
+    F32x4 c1 = simdLoad(m.m[1]);
+    F32x4 c2 = simdLoad(m.m[2]);
+    F32x4 c3 = simdSplat(0);
+    simdTranspose(c0, c1, c2, c3);
+
+    F32x4 v = simdMul(c0, simdSplat(a.x));
+    v = simdAdd(v, simdMul(c1, simdSplat(a.y)));
+    v = simdAdd(v, simdMul(c2, simdSplat(a.z)));
+    v = simdAdd(v, c3);
+    simdStore3(o.e.data(), v);
+}
+
+#endif  // SEAD_MATH_SIMD
+
 template <typename T>
-inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx44& m, const Base& a)
+constexpr void Vector3CalcCommon<T>::mul(Base& o, const Mtx44& m, const Base& a)
 {
     const Base tmp = a;
     T inv = T(1) / (m.m[3][0] * tmp.x + m.m[3][1] * tmp.y + m.m[3][2] * tmp.z + m.m[3][3]);
@@ -158,13 +181,13 @@ inline void Vector3CalcCommon<T>::mul(Base& o, const Mtx44& m, const Base& a)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::rotate(Base& o, const Mtx33& m, const Base& a)
+constexpr void Vector3CalcCommon<T>::rotate(Base& o, const Mtx33& m, const Base& a)
 {
     mul(o, m, a);
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::rotate(Base& o, const Mtx34& m, const Base& a)
+constexpr void Vector3CalcCommon<T>::rotate(Base& o, const Mtx34& m, const Base& a)
 {
     const Base tmp = a;
     o.x = m.m[0][0] * tmp.x + m.m[0][1] * tmp.y + m.m[0][2] * tmp.z;
@@ -172,10 +195,31 @@ inline void Vector3CalcCommon<T>::rotate(Base& o, const Mtx34& m, const Base& a)
     o.z = m.m[2][0] * tmp.x + m.m[2][1] * tmp.y + m.m[2][2] * tmp.z;
 }
 
+#ifdef SEAD_MATH_SIMD
+
+template <>
+inline void Vector3CalcCommon<f32>::rotate(Base& o, const Mtx34& m, const Base& a)
+{
+    using namespace detail;
+
+    F32x4 c0 = simdLoad(m.m[0]);
+    F32x4 c1 = simdLoad(m.m[1]);
+    F32x4 c2 = simdLoad(m.m[2]);
+    F32x4 c3 = simdSplat(0);
+    simdTranspose(c0, c1, c2, c3);
+
+    F32x4 v = simdMul(c0, simdSplat(a.x));
+    v = simdAdd(v, simdMul(c1, simdSplat(a.y)));
+    v = simdAdd(v, simdMul(c2, simdSplat(a.z)));
+    simdStore3(o.e.data(), v);
+}
+
+#endif  // SEAD_MATH_SIMD
+
 template <typename T>
-inline void Vector3CalcCommon<T>::rotate(Base& o, const Quat& q, const Base& v)
+constexpr void Vector3CalcCommon<T>::rotate(Base& o, const Quat& q, const Base& v)
 {
-    Quat r;  // quat-multiplication with 0 on w for v
+    Quat r{};  // quat-multiplication with 0 on w for v
     r.x = (q.y * v.z) - (q.z * v.y) + (q.w * v.x);
     r.y = -(q.x * v.z) + (q.z * v.x) + (q.w * v.y);
     r.z = (q.x * v.y) - (q.y * v.x) + (q.w * v.z);
@@ -188,7 +232,87 @@ inline void Vector3CalcCommon<T>::rotate(Base& o, const Quat& q, const Base& v)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::cross(Base& o, const Base& a, const Base& b)
+void Vector3CalcCommon<T>::transformPoints(Base* o, const Base* a, s32 n, const Mtx34& m)
+{
+    for (s32 i = 0; i < n; ++i)
+        mul(o[i], m, a[i]);
+}
+
+template <typename T>
+void Vector3CalcCommon<T>::transformDirections(Base* o, const Base* a, s32 n, const Mtx34& m)
+{
+    for (s32 i = 0; i < n; ++i)
+        rotate(o[i], m, a[i]);
+}
+
+#ifdef SEAD_MATH_SIMD
+
+template <>
+inline void Vector3CalcCommon<f32>::transformPoints(Base* o, const Base* a, s32 n, const Mtx34& m)
+{
+    using namespace detail;
+
+    const F32x4 m00 = simdSplat(m.m[0][0]), m01 = simdSplat(m.m[0][1]);
+    const F32x4 m02 = simdSplat(m.m[0][2]), m03 = simdSplat(m.m[0][3]);
+    const F32x4 m10 = simdSplat(m.m[1][0]), m11 = simdSplat(m.m[1][1]);
+    const F32x4 m12 = simdSplat(m.m[1][2]), m13 = simdSplat(m.m[1][3]);
+    const F32x4 m20 = simdSplat(m.m[2][0]), m21 = simdSplat(m.m[2][1]);
+    const F32x4 m22 = simdSplat(m.m[2][2]), m23 = simdSplat(m.m[2][3]);
+
+    // Four vectors at a time, one component per register.
+    s32 i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        F32x4 x, y, z;
+        simdLoadDeinterleave3(reinterpret_cast<const f32*>(a + i), x, y, z);
+
+        const F32x4 ox = simdAdd(
+            simdAdd(simdAdd(simdMul(m00, x), simdMul(m01, y)), simdMul(m02, z)), m03);
+        const F32x4 oy = simdAdd(
+            simdAdd(simdAdd(simdMul(m10, x), simdMul(m11, y)), simdMul(m12, z)), m13);
+        const F32x4 oz = simdAdd(
+            simdAdd(simdAdd(simdMul(m20, x), simdMul(m21, y)), simdMul(m22, z)), m23);
+
+        simdStoreInterleave3(reinterpret_cast<f32*>(o + i), ox, oy, oz);
+    }
+
+    for (; i < n; ++i)
+        mul(o[i], m, a[i]);
+}
+
+template <>
+inline void Vector3CalcCommon<f32>::transformDirections(Base* o, const Base* a, s32 n,
+                                                        const Mtx34& m)
+{
+    using namespace detail;
+
+    const F32x4 m00 = simdSplat(m.m[0][0]), m01 = simdSplat(m.m[0][1]);
+    const F32x4 m02 = simdSplat(m.m[0][2]), m10 = simdSplat(m.m[1][0]);
+    const F32x4 m11 = simdSplat(m.m[1][1]), m12 = simdSplat(m.m[1][2]);
+    const F32x4 m20 = simdSplat(m.m[2][0]), m21 = simdSplat(m.m[2][1]);
+    const F32x4 m22 = simdSplat(m.m[2][2]);
+
+    s32 i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        F32x4 x, y, z;
+        simdLoadDeinterleave3(reinterpret_cast<const f32*>(a + i), x, y, z);
+
+        const F32x4 ox = simdAdd(simdAdd(simdMul(m00, x), simdMul(m01, y)), simdMul(m02, z));
+        const F32x4 oy = simdAdd(simdAdd(simdMul(m10, x), simdMul(m11, y)), simdMul(m12, z));
+        const F32x4 oz = simdAdd(simdAdd(simdMul(m20, x), simdMul(m21, y)), simdMul(m22, z));
+
+        simdStoreInterleave3(reinterpret_cast<f32*>(o + i), ox, oy, oz);
+    }
+
+    for (; i < n; ++i)
+        rotate(o[i], m, a[i]);
+}
+
+#endif  // SEAD_MATH_SIMD
+
+template <typename T>
+constexpr void Vector3CalcCommon<T>::cross(Base& o, const Base& a, const Base& b)
 {
     Vector3CalcCommon<T>::set(o, (a.y * b.z) - (a.z * b.y), (a.z * b.x) - (a.x * b.z),
                               (a.x * b.y) - (a.y * b.x));
@@ -205,7 +329,7 @@ inline void Vector3CalcCommon<f32>::cross(Base& o, const Base& a, const Base& b)
 #endif  // cafe
 
 template <typename T>
-inline T Vector3CalcCommon<T>::dot(const Base& a, const Base& b)
+constexpr T Vector3CalcCommon<T>::dot(const Base& a, const Base& b)
 {
     return a.x * b.x + a.y * b.y + a.z * b.z;
 }
@@ -222,7 +346,7 @@ inline f32 Vector3CalcCommon<f32>::dot(const Base& a, const Base& b)
 #endif  // cafe
 
 template <typename T>
-inline T Vector3CalcCommon<T>::squaredLength(const Base& v)
+constexpr T Vector3CalcCommon<T>::squaredLength(const Base& v)
 {
     return v.x * v.x + v.y * v.y + v.z * v.z;
 }
@@ -252,7 +376,7 @@ inline bool Vector3CalcCommon<T>::equals(const Base& lhs, const Base& rhs, T eps
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::multScalar(Base& o, const Base& v, T t)
+constexpr void Vector3CalcCommon<T>::multScalar(Base& o, const Base& v, T t)
 {
     o.x = v.x * t;
     o.y = v.y * t;
@@ -271,7 +395,7 @@ inline void Vector3CalcCommon<f32>::multScalar(Base& o, const Base& v, f32 t)
 #endif  // cafe
 
 template <typename T>
-inline void Vector3CalcCommon<T>::multScalarAdd(Base& o, T t, const Base& a, const Base& b)
+constexpr void Vector3CalcCommon<T>::multScalarAdd(Base& o, T t, const Base& a, const Base& b)
 {
     o.x = a.x * t + b.x;
     o.y = a.y * t + b.y;
@@ -306,7 +430,7 @@ T Vector3CalcCommon<T>::normalize(Base& v)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::negate(Base& v)
+constexpr void Vector3CalcCommon<T>::negate(Base& v)
 {
     v.x = -v.x;
     v.y = -v.y;
@@ -314,13 +438,13 @@ inline void Vector3CalcCommon<T>::negate(Base& v)
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::set(Base& o, const Base& v)
+constexpr void Vector3CalcCommon<T>::set(Base& o, const Base& v)
 {
     o = v;
 }
 
 template <typename T>
-inline void Vector3CalcCommon<T>::set(Base& v, T x, T y, T z)
+constexpr void Vector3CalcCommon<T>::set(Base& v, T x, T y, T z)
 {
     v.x = x;
     v.y = y;
@@ -344,7 +468,7 @@ T Vector4CalcCommon<T>::normalize(Base& v)
 }
 
 template <typename T>
-inline void Vector4CalcCommon<T>::negate(Base& v)
+constexpr void Vector4CalcCommon<T>::negate(Base& v)
 {
     v.x = -v.x;
     v.y = -v.y;
@@ -353,7 +477,7 @@ inline void Vector4CalcCommon<T>::negate(Base& v)
 }
 
 template <typename T>
-inline T Vector4CalcCommon<T>::squaredLength(const Base& v)
+constexpr T Vector4CalcCommon<T>::squaredLength(const Base& v)
 {
     return v.x * v.x + v.y * v.y + v.z * v.z + v.w * v.w;
 }
@@ -365,13 +489,13 @@ inline T Vector4CalcCommon<T>::length(const Base& v)
 }
 
 template <typename T>
-inline void Vector4CalcCommon<T>::set(Base& o, const Base& v)
+constexpr void Vector4CalcCommon<T>::set(Base& o, const Base& v)
 {
     o = v;
 }
 
 template <typename T>
-inline void Vector4CalcCommon<T>::set(Base& v, T x, T y, T z, T w)
+constexpr void Vector4CalcCommon<T>::set(Base& v, T x, T y, T z, T w)
 {
     v.x = x;
     v.y = y;
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <math/seadMathPolicies.h>
+
+namespace sead
+{
+template <typename T, s32 N>
+struct QuatSoA;
+
+template <typename T, s32 N>
+struct Matrix34SoA;
+
+// Structure-of-arrays containers for N vectors, quaternions or matrices.
+//
+// Every component is stored in its own array, so that the lane-wise operations below are plain
+// loops over contiguous streams that the compiler can vectorize at the full SIMD width of the
+// target (4 to 16 lanes) without any gather or shuffle. Use setFromAoS/copyToAoS to convert
+// from and to the regular Vector3/Quat/Matrix34 types.
+//
+// All operations allow the output to be one of the inputs.
+
+template <typename T, s32 N>
+struct Vector3SoA
+{
+    using Vec3 = typename Policies<T>::Vec3Base;
+    using Mtx34 = typename Policies<T>::Mtx34Base;
+
+    static constexpr s32 size() { return N; }
+
+    void get(Vec3& o, s32 i) const;
+    void set(s32 i, const Vec3& v);
+    /// Copies `num` vectors to lanes [0, num).
+    void setFromAoS(const Vec3* v, s32 num = N);
+    /// Copies lanes [0, num) to `num` vectors.
+    void copyToAoS(Vec3* v, s32 num = N) const;
+
+    void setZero();
+    void setAdd(const Vector3SoA& a, const Vector3SoA& b);
+    void setSub(const Vector3SoA& a, const Vector3SoA& b);
+    void setScale(const Vector3SoA& a, T t);
+    void setCross(const Vector3SoA& a, const Vector3SoA& b);
+    /// Apply a transformation `m` (rotation then translation) to every lane.
+    void setMul(const Mtx34& m, const Vector3SoA& a);
+    /// Apply the transformation in lane i of `m` to lane i of `a`.
+    void setMul(const Matrix34SoA<T, N>& m, const Vector3SoA& a);
+    /// Apply a rotation `m` to every lane.
+    void setRotated(const Mtx34& m, const Vector3SoA& a);
+    /// Apply the rotation in lane i of `q` to lane i of `a`.
+    void setRotated(const QuatSoA<T, N>& q, const Vector3SoA& a);
+    /// Normalizes every lane. Lanes with a zero length are left unchanged.
+    void normalize();
+
+    static void dot(T* o, const Vector3SoA& a, const Vector3SoA& b);
+    void calcSquaredLength(T* o) const;
+    void calcLength(T* o) const;
+
+    alignas(16) T x[N];
+    alignas(16) T y[N];
+    alignas(16) T z[N];
+};
+
+template <typename T, s32 N>
+struct QuatSoA
+{
+    using Quat = typename Policies<T>::QuatBase;
+
+    static constexpr s32 size() { return N; }
+
+    void get(Quat& o, s32 i) const;
+    void set(s32 i, const Quat& q);
+    void setFromAoS(const Quat* q, s32 num = N);
+    void copyToAoS(Quat* q, s32 num = N) const;
+
+    void makeUnit();
+    void setAdd(const QuatSoA& a, const QuatSoA& b);
+    /// Quaternion product of lane i of `a` and `b`.
+    void setMul(const QuatSoA& a, const QuatSoA& b);
+    /// Normalizes every lane. Lanes with a zero length are left unchanged.
+    void normalize();
+
+    static void dot(T* o, const QuatSoA& a, const QuatSoA& b);
+
+    alignas(16) T x[N];
+    alignas(16) T y[N];
+    alignas(16) T z[N];
+    alignas(16) T w[N];
+};
+
+template <typename T, s32 N>
+struct Matrix34SoA
+{
+    using Mtx34 = typename Policies<T>::Mtx34Base;
+
+    static constexpr s32 size() { return N; }
+
+    void get(Mtx34& o, s32 i) const;
+    void set(s32 i, const Mtx34& n);
+    void setFromAoS(const Mtx34* n, s32 num = N);
+    void copyToAoS(Mtx34* n, s32 num = N) const;
+
+    void makeIdentity();
+    /// Lane-wise product of `a` and `b`.
+    void setMul(const Matrix34SoA& a, const Matrix34SoA& b);
+    /// Product of `a` and every lane of `b`.
+    void setMul(const Mtx34& a, const Matrix34SoA& b);
+    /// Builds lane i from the rotation in lane i of `q` (assumed to be normalized) and the
+    /// translation in lane i of `t`.
+    void makeQT(const QuatSoA<T, N>& q, const Vector3SoA<T, N>& t);
+
+    /// m[row][column] is the stream of that element for all lanes.
+    alignas(16) T m[3][4][N];
+};
+
+using Vector3fSoA4 = Vector3SoA<f32, 4>;
+using QuatfSoA4 = QuatSoA<f32, 4>;
+using Matrix34fSoA4 = Matrix34SoA<f32, 4>;
+
+}  // namespace sead
+
+#define SEAD_MATH_VECTOR_SOA_H_
+#include <math/seadVectorSoA.hpp>
+#undef SEAD_MATH_VECTOR_SOA_H_
@@ -0,0 +1,419 @@
+#pragma once
+
+#include <basis/seadRawPrint.h>
+#include <math/seadMathCalcCommon.h>
+#ifndef SEAD_MATH_VECTOR_SOA_H_
+#include <math/seadVectorSoA.h>
+#endif
+
+namespace sead
+{
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::get(Vec3& o, s32 i) const
+{
+    o.x = x[i];
+    o.y = y[i];
+    o.z = z[i];
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::set(s32 i, const Vec3& v)
+{
+    x[i] = v.x;
+    y[i] = v.y;
+    z[i] = v.z;
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setFromAoS(const Vec3* v, s32 num)
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        set(i, v[i]);
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::copyToAoS(Vec3* v, s32 num) const
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        get(v[i], i);
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setZero()
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = 0;
+        y[i] = 0;
+        z[i] = 0;
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setAdd(const Vector3SoA& a, const Vector3SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = a.x[i] + b.x[i];
+        y[i] = a.y[i] + b.y[i];
+        z[i] = a.z[i] + b.z[i];
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setSub(const Vector3SoA& a, const Vector3SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = a.x[i] - b.x[i];
+        y[i] = a.y[i] - b.y[i];
+        z[i] = a.z[i] - b.z[i];
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setScale(const Vector3SoA& a, T t)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = a.x[i] * t;
+        y[i] = a.y[i] * t;
+        z[i] = a.z[i] * t;
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setCross(const Vector3SoA& a, const Vector3SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T cx = (a.y[i] * b.z[i]) - (a.z[i] * b.y[i]);
+        const T cy = (a.z[i] * b.x[i]) - (a.x[i] * b.z[i]);
+        const T cz = (a.x[i] * b.y[i]) - (a.y[i] * b.x[i]);
+        x[i] = cx;
+        y[i] = cy;
+        z[i] = cz;
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setMul(const Mtx34& m, const Vector3SoA& a)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T vx = a.x[i];
+        const T vy = a.y[i];
+        const T vz = a.z[i];
+        x[i] = m.m[0][0] * vx + m.m[0][1] * vy + m.m[0][2] * vz + m.m[0][3];
+        y[i] = m.m[1][0] * vx + m.m[1][1] * vy + m.m[1][2] * vz + m.m[1][3];
+        z[i] = m.m[2][0] * vx + m.m[2][1] * vy + m.m[2][2] * vz + m.m[2][3];
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setMul(const Matrix34SoA<T, N>& m, const Vector3SoA& a)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T vx = a.x[i];
+        const T vy = a.y[i];
+        const T vz = a.z[i];
+        x[i] = m.m[0][0][i] * vx + m.m[0][1][i] * vy + m.m[0][2][i] * vz + m.m[0][3][i];
+        y[i] = m.m[1][0][i] * vx + m.m[1][1][i] * vy + m.m[1][2][i] * vz + m.m[1][3][i];
+        z[i] = m.m[2][0][i] * vx + m.m[2][1][i] * vy + m.m[2][2][i] * vz + m.m[2][3][i];
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setRotated(const Mtx34& m, const Vector3SoA& a)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T vx = a.x[i];
+        const T vy = a.y[i];
+        const T vz = a.z[i];
+        x[i] = m.m[0][0] * vx + m.m[0][1] * vy + m.m[0][2] * vz;
+        y[i] = m.m[1][0] * vx + m.m[1][1] * vy + m.m[1][2] * vz;
+        z[i] = m.m[2][0] * vx + m.m[2][1] * vy + m.m[2][2] * vz;
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::setRotated(const QuatSoA<T, N>& q, const Vector3SoA& a)
+{
+    // Same as Vector3CalcCommon::rotate(Base&, const Quat&, const Base&), one lane at a time.
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T qx = q.x[i];
+        const T qy = q.y[i];
+        const T qz = q.z[i];
+        const T qw = q.w[i];
+        const T vx = a.x[i];
+        const T vy = a.y[i];
+        const T vz = a.z[i];
+
+        const T rx = (qy * vz) - (qz * vy) + (qw * vx);
+        const T ry = -(qx * vz) + (qz * vx) + (qw * vy);
+        const T rz = (qx * vy) - (qy * vx) + (qw * vz);
+        const T rw = -(qx * vx) - (qy * vy) - (qz * vz);
+
+        x[i] = (rx * qw) - (ry * qz) + (rz * qy) - (rw * qx);
+        y[i] = (rx * qz) + (ry * qw) - (rz * qx) - (rw * qy);
+        z[i] = -(rx * qy) + (ry * qx) + (rz * qw) - (rw * qz);
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::normalize()
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T len = MathCalcCommon<T>::sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        const T inv_len = len > 0 ? 1 / len : 1;
+        x[i] *= inv_len;
+        y[i] *= inv_len;
+        z[i] *= inv_len;
+    }
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::dot(T* o, const Vector3SoA& a, const Vector3SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+        o[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::calcSquaredLength(T* o) const
+{
+    dot(o, *this, *this);
+}
+
+template <typename T, s32 N>
+inline void Vector3SoA<T, N>::calcLength(T* o) const
+{
+    calcSquaredLength(o);
+    for (s32 i = 0; i < N; ++i)
+        o[i] = MathCalcCommon<T>::sqrt(o[i]);
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::get(Quat& o, s32 i) const
+{
+    o.x = x[i];
+    o.y = y[i];
+    o.z = z[i];
+    o.w = w[i];
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::set(s32 i, const Quat& q)
+{
+    x[i] = q.x;
+    y[i] = q.y;
+    z[i] = q.z;
+    w[i] = q.w;
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::setFromAoS(const Quat* q, s32 num)
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        set(i, q[i]);
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::copyToAoS(Quat* q, s32 num) const
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        get(q[i], i);
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::makeUnit()
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = 0;
+        y[i] = 0;
+        z[i] = 0;
+        w[i] = 1;
+    }
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::setAdd(const QuatSoA& a, const QuatSoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        x[i] = a.x[i] + b.x[i];
+        y[i] = a.y[i] + b.y[i];
+        z[i] = a.z[i] + b.z[i];
+        w[i] = a.w[i] + b.w[i];
+    }
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::setMul(const QuatSoA& a, const QuatSoA& b)
+{
+    // Same as QuatCalcCommon::setMul, one lane at a time.
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T uw = a.w[i], ux = a.x[i], uy = a.y[i], uz = a.z[i];
+        const T vw = b.w[i], vx = b.x[i], vy = b.y[i], vz = b.z[i];
+
+        w[i] = (uw * vw) - (ux * vx) - (uy * vy) - (uz * vz);
+        x[i] = (uw * vx) + (ux * vw) + (uy * vz) - (uz * vy);
+        y[i] = (uw * vy) - (ux * vz) + (uy * vw) + (uz * vx);
+        z[i] = (uw * vz) + (ux * vy) - (uy * vx) + (uz * vw);
+    }
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::normalize()
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T len =
+            MathCalcCommon<T>::sqrt(w[i] * w[i] + x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        const T inv_len = len > 0 ? 1 / len : 1;
+        w[i] *= inv_len;
+        x[i] *= inv_len;
+        y[i] *= inv_len;
+        z[i] *= inv_len;
+    }
+}
+
+template <typename T, s32 N>
+inline void QuatSoA<T, N>::dot(T* o, const QuatSoA& a, const QuatSoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+        o[i] = a.w[i] * b.w[i] + a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::get(Mtx34& o, s32 i) const
+{
+    for (s32 r = 0; r < 3; ++r)
+        for (s32 c = 0; c < 4; ++c)
+            o.m[r][c] = m[r][c][i];
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::set(s32 i, const Mtx34& n)
+{
+    for (s32 r = 0; r < 3; ++r)
+        for (s32 c = 0; c < 4; ++c)
+            m[r][c][i] = n.m[r][c];
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::setFromAoS(const Mtx34* n, s32 num)
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        set(i, n[i]);
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::copyToAoS(Mtx34* n, s32 num) const
+{
+    SEAD_ASSERT(0 <= num && num <= N);
+    for (s32 i = 0; i < num; ++i)
+        get(n[i], i);
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::makeIdentity()
+{
+    for (s32 r = 0; r < 3; ++r)
+        for (s32 c = 0; c < 4; ++c)
+            for (s32 i = 0; i < N; ++i)
+                m[r][c][i] = r == c ? 1 : 0;
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::setMul(const Matrix34SoA& a, const Matrix34SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        T o[3][4];
+        for (s32 r = 0; r < 3; ++r)
+        {
+            const T a0 = a.m[r][0][i];
+            const T a1 = a.m[r][1][i];
+            const T a2 = a.m[r][2][i];
+            o[r][0] = a0 * b.m[0][0][i] + a1 * b.m[1][0][i] + a2 * b.m[2][0][i];
+            o[r][1] = a0 * b.m[0][1][i] + a1 * b.m[1][1][i] + a2 * b.m[2][1][i];
+            o[r][2] = a0 * b.m[0][2][i] + a1 * b.m[1][2][i] + a2 * b.m[2][2][i];
+            o[r][3] = a0 * b.m[0][3][i] + a1 * b.m[1][3][i] + a2 * b.m[2][3][i] + a.m[r][3][i];
+        }
+
+        for (s32 r = 0; r < 3; ++r)
+            for (s32 c = 0; c < 4; ++c)
+                m[r][c][i] = o[r][c];
+    }
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::setMul(const Mtx34& a, const Matrix34SoA& b)
+{
+    for (s32 i = 0; i < N; ++i)
+    {
+        T o[3][4];
+        for (s32 r = 0; r < 3; ++r)
+        {
+            const T a0 = a.m[r][0];
+            const T a1 = a.m[r][1];
+            const T a2 = a.m[r][2];
+            o[r][0] = a0 * b.m[0][0][i] + a1 * b.m[1][0][i] + a2 * b.m[2][0][i];
+            o[r][1] = a0 * b.m[0][1][i] + a1 * b.m[1][1][i] + a2 * b.m[2][1][i];
+            o[r][2] = a0 * b.m[0][2][i] + a1 * b.m[1][2][i] + a2 * b.m[2][2][i];
+            o[r][3] = a0 * b.m[0][3][i] + a1 * b.m[1][3][i] + a2 * b.m[2][3][i] + a.m[r][3];
+        }
+
+        for (s32 r = 0; r < 3; ++r)
+            for (s32 c = 0; c < 4; ++c)
+                m[r][c][i] = o[r][c];
+    }
+}
+
+template <typename T, s32 N>
+inline void Matrix34SoA<T, N>::makeQT(const QuatSoA<T, N>& q, const Vector3SoA<T, N>& t)
+{
+    // Same as Matrix34CalcCommon::makeQT, one lane at a time.
+    for (s32 i = 0; i < N; ++i)
+    {
+        const T yy = 2 * q.y[i] * q.y[i];
+        const T zz = 2 * q.z[i] * q.z[i];
+        const T xx = 2 * q.x[i] * q.x[i];
+        const T xy = 2 * q.x[i] * q.y[i];
+        const T xz = 2 * q.x[i] * q.z[i];
+        const T yz = 2 * q.y[i] * q.z[i];
+        const T wz = 2 * q.w[i] * q.z[i];
+        const T wx = 2 * q.w[i] * q.x[i];
+        const T wy = 2 * q.w[i] * q.y[i];
+
+        m[0][0][i] = 1 - yy - zz;
+        m[0][1][i] = xy - wz;
+        m[0][2][i] = xz + wy;
+
+        m[1][0][i] = xy + wz;
+        m[1][1][i] = 1 - xx - zz;
+        m[1][2][i] = yz - wx;
+
+        m[2][0][i] = xz - wy;
+        m[2][1][i] = yz + wx;
+        m[2][2][i] = 1 - xx - yy;
+
+        m[0][3][i] = t.x[i];
+        m[1][3][i] = t.y[i];
+        m[2][3][i] = t.z[i];
+    }
+}
+
+}  // namespace sead
@@ -23,6 +23,8 @@ class PerfJobQueue
 {
 public:
     void initialize(const char* name, Heap* heap);
+    /// Like initialize, but returns false instead of asserting if the allocation fails.
+    bool tryInitialize(const char* name, Heap* heap);
     void finalize();
     void reset();
 
@@ -36,6 +38,8 @@ public:
     void detachProcessMeter();
 
 private:
+    void initMeters_(const char* name);
+
     Buffer<MultiProcessMeterBar<512>> mBars;
     Buffer<u32> mInts;
     MultiProcessMeterBar<1> mProcessMeterBar;
@@ -134,6 +138,8 @@ public:
     u32 getNumJobs() const override;
 
     void initialize(u32 size, Heap* heap);
+    /// Like initialize, but returns false instead of asserting if the allocation fails.
+    bool tryInitialize(u32 size, Heap* heap);
     void finalize();
 
     bool enque(Job* job);
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <new>
+
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "basis/seadTypes.h"
+#include "container/seadObjArray.h"
+#include "container/seadPtrArray.h"
+#include "mc/seadCoreInfo.h"
+#include "mc/seadJob.h"
+#include "mc/seadJobQueue.h"
+#include "mc/seadWorkerMgr.h"
+
+namespace sead
+{
+class Heap;
+
+/// Merge sort of pointer arrays on the cores of a WorkerMgr.
+///
+/// The array is split into one chunk per core (rounded up to a power of two); the chunks are
+/// sorted in parallel with std::sort, then merged pairwise, with the merges of each level also
+/// running in parallel. Every level is one job queue pushed to `mgr` and waited for with
+/// WorkerMgr::run and WorkerMgr::sync, so this must be called from the thread that calls
+/// WorkerMgr::run, when no other job queue is pushed. The last merge runs on a single core,
+/// which limits the speedup of the merges.
+///
+/// Compare must have the signature s32 (const T*, const T*), like PtrArray::CompareCallback,
+/// and is inlined. The sort is not stable. It needs a work buffer of one pointer per element,
+/// which is allocated from `work_heap` (or the current heap if it is null).
+class ParallelSort
+{
+public:
+    /// Arrays smaller than this are sorted on the calling thread.
+    static constexpr s32 cParallelNumMin = 0x1000;
+    static constexpr s32 cChunkNumMax = 32;
+
+    template <typename T, typename Compare>
+    static bool sort(PtrArray<T>* array, const Compare& cmp, WorkerMgr* mgr, CoreIdMask mask,
+                     Heap* work_heap = nullptr)
+    {
+        return sort(array->data(), array->size(), cmp, mgr, mask, work_heap);
+    }
+
+    template <typename T, typename Compare>
+    static bool sort(ObjArray<T>* array, const Compare& cmp, WorkerMgr* mgr, CoreIdMask mask,
+                     Heap* work_heap = nullptr)
+    {
+        return sort(array->data(), array->size(), cmp, mgr, mask, work_heap);
+    }
+
+    /// Returns false if the work buffers could not be allocated (the array is left unsorted).
+    template <typename T, typename Compare>
+    static bool sort(T** ptrs, s32 num, const Compare& cmp, WorkerMgr* mgr, CoreIdMask mask,
+                     Heap* work_heap = nullptr);
+
+private:
+    template <typename T, typename Compare>
+    class SortJob : public Job
+    {
+    public:
+        void invoke() override
+        {
+            const auto less = [this](const T* a, const T* b) { return (*mCmp)(a, b) < 0; };
+            if (mMiddle == nullptr)
+                std::sort(mBegin, mEnd, less);
+            else
+                std::merge(mBegin, mMiddle, mMiddle, mEnd, mDst, less);
+        }
+
+        /// The range to sort in place, or the two ranges to merge into `mDst`.
+        T** mBegin = nullptr;
+        T** mMiddle = nullptr;
+        T** mEnd = nullptr;
+        T** mDst = nullptr;
+        const Compare* mCmp = nullptr;
+    };
+
+    static s32 calcChunkNum(CoreIdMask mask)
+    {
+        const s32 cores = std::max<s32>(1, mask.countOnBits());
+        s32 num = 1;
+        while (num < cores && num < cChunkNumMax)
+            num <<= 1;
+        return num;
+    }
+
+    /// Runs `num` jobs through `queue`, which is cleared first so that it can be reused for
+    /// every level. Returns false if the queue is too small.
+    template <typename JobType>
+    static bool runJobs(FixedSizeJQ* queue, JobType* jobs, s32 num, WorkerMgr* mgr,
+                        CoreIdMask mask)
+    {
+        queue->clear();
+        // The finish event is only reset by the workers, so it is still signaled by the
+        // previous level: reset it before the queue is pushed, or sync() may not wait.
+        queue->resetFinishEvent();
+        for (s32 i = 0; i < num; ++i)
+        {
+            if (!queue->enque(&jobs[i]))
+            {
+                SEAD_ASSERT_MSG(false, "job queue is full [%d]", num);
+                return false;
+            }
+        }
+        mgr->pushJobQueue("ParallelSort", queue, mask, SyncType::cCore,
+                          JobQueuePushType::cForward);
+        mgr->run();
+        mgr->sync();
+        return true;
+    }
+};
+
+template <typename T, typename Compare>
+inline bool ParallelSort::sort(T** ptrs, s32 num, const Compare& cmp, WorkerMgr* mgr,
+                               CoreIdMask mask, Heap* work_heap)
+{
+    const auto less = [&cmp](const T* a, const T* b) { return cmp(a, b) < 0; };
+
+    const s32 chunk_num = calcChunkNum(mask);
+    if (num < cParallelNumMin || chunk_num == 1 || !mgr)
+    {
+        std::sort(ptrs, ptrs + num, less);
+        return true;
+    }
+
+    // Allocate everything before sorting anything, so that a failure leaves the array as it
+    // was. No level runs more jobs than there are chunks.
+    T** tmp = new (work_heap, std::nothrow) T*[num];
+    if (!tmp)
+    {
+        SEAD_ASSERT_MSG(false, "failed to allocate the work buffer [%zu]", sizeof(T*) * num);
+        return false;
+    }
+    FixedSizeJQ queue;
+    if (!queue.tryInitialize(chunk_num, work_heap))
+    {
+        SEAD_ASSERT_MSG(false, "failed to allocate the job queue [%d]", chunk_num);
+        delete[] tmp;
+        return false;
+    }
+
+    // Chunk boundaries; chunk i is [bounds[i], bounds[i + 1]).
+    s32 bounds[cChunkNumMax + 1];
+    for (s32 i = 0; i <= chunk_num; ++i)
+        bounds[i] = s32(s64(num) * i / chunk_num);
+
+    SortJob<T, Compare> jobs[cChunkNumMax];
+    for (s32 i = 0; i < chunk_num; ++i)
+    {
+        jobs[i].mBegin = ptrs + bounds[i];
+        jobs[i].mEnd = ptrs + bounds[i + 1];
+        jobs[i].mCmp = &cmp;
+    }
+    bool ok = runJobs(&queue, jobs, chunk_num, mgr, mask);
+
+    // Merge pairs of sorted runs from src to dst until one run is left.
+    T** src = ptrs;
+    T** dst = tmp;
+    for (s32 width = 1; ok && width < chunk_num; width *= 2)
+    {
+        s32 job_num = 0;
+        for (s32 i = 0; i < chunk_num; i += width * 2)
+        {
+            SortJob<T, Compare>& job = jobs[job_num++];
+            job.mBegin = src + bounds[i];
+            job.mMiddle = src + bounds[i + width];
+            job.mEnd = src + bounds[i + width * 2];
+            job.mDst = dst + bounds[i];
+        }
+        ok = runJobs(&queue, jobs, job_num, mgr, mask);
+        if (ok)
+            std::swap(src, dst);
+    }
+
+    if (src != ptrs)
+        std::copy(src, src + num, ptrs);
+
+    queue.finalize();
+    delete[] tmp;
+    return ok;
+}
+
+}  // namespace sead
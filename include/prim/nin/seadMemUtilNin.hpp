@@ -38,4 +38,13 @@ inline int MemUtil::compare(const void* ptr1, const void* ptr2, size_t size)
 {
     return std::memcmp(ptr1, ptr2, size);
 }
+
+inline void MemUtil::prefetch(const void* addr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(addr);
+#else
+    static_cast<void>(addr);
+#endif
+}
 }  // namespace sead
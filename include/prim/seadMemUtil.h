@@ -14,6 +14,8 @@ public:
     static void* copy(void* dest, const void* src, size_t size);
     static void* copyAlign32(void* dest, const void* src, size_t size);
     static int compare(const void* ptr1, const void* ptr2, size_t size);
+    /// Hint that `addr` will be read soon, to start loading its cache line. Never faults.
+    static void prefetch(const void* addr);
 
     static bool isStack(const void* addr);
     static bool isHeap(const void* addr);
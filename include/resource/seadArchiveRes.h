@@ -47,6 +47,19 @@ public:
         return convertPathToEntryIDImpl_(path);
     }
 
+    /// Converts several paths at once. entry_ids[i] is set to -1 if paths[i] does not exist.
+    void convertPathsToEntryIDs(const SafeString* paths, s32* entry_ids, s32 num) const
+    {
+        SEAD_ASSERT(mEnable);
+        convertPathsToEntryIDsImpl_(paths, entry_ids, num);
+    }
+
+    /// Looks up several files at once. files[i] is set to nullptr if paths[i] does not exist.
+    /// @param file_infos  Optional (may be null).
+    /// @returns the number of files that were found
+    s32 getFiles(const void** files, FileInfo* file_infos, const SafeString* paths,
+                 s32 num) const;
+
     bool setCurrentDirectory(const SafeString& dir)
     {
         SEAD_ASSERT(mEnable);
@@ -72,6 +85,8 @@ protected:
                                      FileInfo* file_info = nullptr) const = 0;
     virtual const void* getFileFastImpl_(s32 entry_id, FileInfo* file_info) const = 0;
     virtual s32 convertPathToEntryIDImpl_(const SafeString& file_path) const = 0;
+    virtual void convertPathsToEntryIDsImpl_(const SafeString* paths, s32* entry_ids,
+                                             s32 num) const;
     virtual bool setCurrentDirectoryImpl_(const SafeString&) = 0;
     virtual bool openDirectoryImpl_(HandleBuffer* handle, const SafeString& path) const = 0;
     virtual bool closeDirectoryImpl_(HandleBuffer* handle) const = 0;
@@ -4,15 +4,19 @@
 #include <basis/seadTypes.h>
 #include <container/seadBuffer.h>
 #include <filedevice/seadFileDevice.h>
+#include <heap/seadHeap.h>
 #include <prim/seadEndian.h>
 #include <prim/seadSafeString.h>
 #include <resource/seadArchiveRes.h>
 
 namespace sead
 {
+class SharcArchiveWriter;
+
 class SharcArchiveRes : public ArchiveRes
 {
     SEAD_RTTI_OVERRIDE(SharcArchiveRes, ArchiveRes)
+    friend class SharcArchiveWriter;
 
 public:
     struct ArchiveBlockHeader
@@ -57,6 +61,8 @@ public:
                              FileInfo* file_info = NULL) const override;
     const void* getFileFastImpl_(s32 entry_id, FileInfo* file_info) const override;
     s32 convertPathToEntryIDImpl_(const SafeString& file_path) const override;
+    void convertPathsToEntryIDsImpl_(const SafeString* paths, s32* entry_ids,
+                                     s32 num) const override;
     bool setCurrentDirectoryImpl_(const SafeString&) override;
     bool openDirectoryImpl_(HandleBuffer* handle, const SafeString& path) const override;
     bool closeDirectoryImpl_(HandleBuffer* handle) const override;
@@ -64,10 +70,38 @@ public:
     bool isExistFileImpl_(const SafeString& path) const override;
     bool prepareArchive_(const void* archive) override;
 
+    /// Builds an optional lookup index over the FAT: a host-endian copy of every entry hash
+    /// plus an open-addressing table that maps a hash to the first entry of its collision run.
+    /// Once built, path lookups no longer binary search the (possibly byte-swapped) FAT.
+    /// The index is discarded when another archive is prepared.
+    /// @returns true if the index is ready
+    bool createLookupTable(Heap* heap);
+    void freeLookupTable();
+    bool isLookupTableReady() const { return mLookupSlots.isBufferReady(); }
+
+    /// Hash function used for FAT entries. Characters are treated as signed values.
+    static u32 calcHash32(const SafeString& str, u32 key);
+
 protected:
     struct HandleInner;
     HandleInner* getHandleInner_(HandleBuffer* handle, bool create = false) const;
 
+    u32 calcPathHash_(const SafeString& path) const;
+    /// Returns the ID of an entry with the specified hash, or -1 if there is none.
+    /// The entry is not necessarily the first entry of its collision run.
+    s32 searchEntryIDByHash_(u32 hash) const;
+    /// Returns the index of the first entry whose hash is not less than the specified hash,
+    /// searching [start, mFATEntrys.size()) only.
+    s32 lowerBoundEntryID_(u32 hash, s32 start) const;
+    /// Given any entry of a collision run, returns the ID of the entry whose name matches.
+    s32 resolveHashCollision_(s32 id, u32 hash, const SafeString& path) const;
+    u32 getEntryHash_(s32 id) const
+    {
+        if (mHostHashes.isBufferReady())
+            return mHostHashes(id);
+        return Endian::toHostU32(mEndianType, mFATEntrys(id).hash);
+    }
+
     static const u32 cArchiveVersion = 0x100;
     static const u32 cArchiveEntryMax = 0x3fff;
     static const u32 cFileNameTableAlign = 4;
@@ -78,6 +112,11 @@ protected:
     Buffer<const FATEntry> mFATEntrys;
     const u8* mDataBlock;
     Endian::Types mEndianType;
+    /// Host-endian entry hashes (same order as mFATEntrys).
+    Buffer<u32> mHostHashes;
+    /// Open-addressing slots holding (entry ID + 1), or 0 if the slot is empty.
+    Buffer<u16> mLookupSlots;
+    u32 mLookupSlotShift;
 };
 
 }  // namespace sead
@@ -0,0 +1,110 @@
+#ifndef SEAD_SHARC_ARCHIVE_WRITER_H_
+#define SEAD_SHARC_ARCHIVE_WRITER_H_
+
+#include <basis/seadRawPrint.h>
+#include <basis/seadTypes.h>
+#include <container/seadBuffer.h>
+#include <heap/seadHeap.h>
+#include <prim/seadEndian.h>
+#include <prim/seadSafeString.h>
+#include <resource/seadSharcArchiveRes.h>
+
+namespace sead
+{
+class WriteStream;
+
+/// Builds SARC archives that can be read by SharcArchiveRes.
+///
+/// The writer does not copy file names or file data: every pointer that is passed to addFile
+/// (and the archive passed to addArchive) must stay valid until the archive has been written.
+/// If the same path is added several times, the file that was added last wins, which makes it
+/// possible to patch an archive by calling addArchive() and then addFile() for modified files.
+class SharcArchiveWriter
+{
+public:
+    static const u32 cDefaultHashKey = 0x65;
+    static const u32 cDefaultDataAlignment = 4;
+
+public:
+    SharcArchiveWriter();
+    ~SharcArchiveWriter();
+
+    /// Allocates bookkeeping buffers for at most max_files entries.
+    void allocBuffer(s32 max_files, Heap* heap);
+    bool tryAllocBuffer(s32 max_files, Heap* heap);
+    void freeBuffer();
+    bool isBufferReady() const { return mEntries.isBufferReady(); }
+
+    /// Must be called before any file is added.
+    void setHashKey(u32 key)
+    {
+        SEAD_ASSERT_MSG(mNumEntries == 0, "hash key must be set before adding files");
+        mHashKey = key;
+    }
+    u32 getHashKey() const { return mHashKey; }
+    void setEndian(Endian::Types endian) { mEndian = endian; }
+    Endian::Types getEndian() const { return mEndian; }
+    /// Sets the alignment that is used when addFile() is called without an explicit alignment.
+    void setDefaultAlignment(u32 alignment);
+
+    /// @param alignment  Power of two, or 0 to use the default alignment.
+    bool addFile(const SafeString& path, const void* data, u32 size, u32 alignment = 0);
+    /// Adds every member of an existing archive without copying it.
+    /// Members keep their original alignment if possible.
+    /// @returns the number of files that were added
+    s32 addArchive(const SharcArchiveRes& archive);
+    void clear() { mNumEntries = 0; }
+    s32 getNumFiles() const { return mNumEntries; }
+
+    /// Computes the size of the archive that would be written.
+    u32 calcArchiveSize();
+    /// @returns the number of bytes written, or 0 on failure
+    u32 write(WriteStream* stream);
+    /// @returns the number of bytes written, or 0 on failure (including if the buffer is too small)
+    u32 write(void* buffer, u32 buffer_size);
+
+private:
+    struct Entry
+    {
+        /// Null for entries that only have a hash (from an archive without names).
+        const char* name;
+        u32 name_length;
+        u32 hash;
+        const void* data;
+        u32 size;
+        u32 alignment;
+        u32 data_offset;
+        u32 name_offset;
+    };
+
+    struct Layout
+    {
+        u32 num_files;
+        u32 fnt_size;
+        u32 data_block_offset;
+        u32 file_size;
+    };
+
+    bool addEntry_(const char* name, u32 hash, const void* data, u32 size, u32 alignment);
+    /// Sorts the entries, removes overridden entries and assigns name and data offsets.
+    bool calcLayout_(Layout* layout);
+    template <typename Sink>
+    u32 write_(Sink* sink, const Layout& layout) const;
+
+    Buffer<Entry> mEntries;
+    /// Indices into mEntries, sorted by hash and without duplicates after calcLayout_.
+    /// Only the first Layout::num_files indices are valid.
+    Buffer<s32> mOrder;
+    s32 mNumEntries = 0;
+    u32 mHashKey = cDefaultHashKey;
+    u32 mDefaultAlignment = cDefaultDataAlignment;
+#ifdef cafe
+    Endian::Types mEndian = Endian::cBig;
+#else
+    Endian::Types mEndian = Endian::cLittle;
+#endif
+};
+
+}  // namespace sead
+
+#endif  // SEAD_SHARC_ARCHIVE_WRITER_H_
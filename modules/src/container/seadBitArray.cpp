@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <basis/seadNew.h>
+#include <basis/seadRawPrint.h>
+#include <container/seadBitArray.h>
+#include <math/seadMathPolicies.h>
+#include <prim/seadBitFlag.h>
+
+#if defined(SEAD_MATH_SIMD_NEON)
+#include <arm_neon.h>
+#elif defined(SEAD_MATH_SIMD_SSE) && defined(__SSSE3__) && !defined(__POPCNT__)
+#include <tmmintrin.h>
+#define SEAD_BIT_ARRAY_SSSE3
+#endif
+
+namespace sead
+{
+void BitArray::allocBuffer(s32 bit_num, Heap* heap, s32 alignment)
+{
+    if (!tryAllocBuffer(bit_num, heap, alignment))
+        AllocFailAssert(heap, calculateWorkBufferSize(bit_num), alignment);
+}
+
+bool BitArray::tryAllocBuffer(s32 bit_num, Heap* heap, s32 alignment)
+{
+    SEAD_ASSERT(mWords == nullptr);
+
+    if (bit_num < 1)
+    {
+        SEAD_ASSERT_MSG(false, "bit_num[%d] must be larger than zero", bit_num);
+        return false;
+    }
+
+    alignment = std::max(alignment, s32(alignof(Word)));
+    auto* buf = new (heap, alignment, std::nothrow) u8[calculateWorkBufferSize(bit_num)];
+    if (!buf)
+        return false;
+
+    setBuffer(bit_num, buf);
+    return true;
+}
+
+void BitArray::setBuffer(s32 bit_num, void* buffer)
+{
+    if (!buffer)
+    {
+        SEAD_ASSERT_MSG(false, "buffer is null");
+        return;
+    }
+
+    mWords = static_cast<Word*>(buffer);
+    mBitNum = bit_num;
+    mWordNum = calcWordNum(bit_num);
+    mRankIndex = reinterpret_cast<u32*>(mWords + mWordNum);
+    makeAllZero();
+    updateRankIndex();
+}
+
+void BitArray::freeBuffer()
+{
+    if (!isBufferReady())
+        return;
+
+    delete[] reinterpret_cast<u8*>(mWords);
+    mWords = nullptr;
+    mRankIndex = nullptr;
+    mBitNum = 0;
+    mWordNum = 0;
+}
+
+BitArray::Word BitArray::getLastWordMask_() const
+{
+    const s32 used = mBitNum % cBitsPerWord;
+    return used == 0 ? ~Word(0) : (Word(1) << used) - 1;
+}
+
+void BitArray::makeAllZero()
+{
+    std::fill_n(mWords, mWordNum, Word(0));
+}
+
+void BitArray::makeAllOne()
+{
+    if (mWordNum == 0)
+        return;
+
+    std::fill_n(mWords, mWordNum, ~Word(0));
+    mWords[mWordNum - 1] = getLastWordMask_();
+}
+
+bool BitArray::isZero() const
+{
+    Word bits = 0;
+    for (s32 i = 0; i < mWordNum; ++i)
+        bits |= mWords[i];
+    return bits == 0;
+}
+
+// The loops below are simple enough for the compiler to vectorize.
+
+void BitArray::orWith(const BitArray& other)
+{
+    SEAD_ASSERT_MSG(mBitNum == other.mBitNum, "size mismatch [%d != %d]", mBitNum,
+                    other.mBitNum);
+    const s32 num = std::min(mWordNum, other.mWordNum);
+    for (s32 i = 0; i < num; ++i)
+        mWords[i] |= other.mWords[i];
+}
+
+void BitArray::andWith(const BitArray& other)
+{
+    SEAD_ASSERT_MSG(mBitNum == other.mBitNum, "size mismatch [%d != %d]", mBitNum,
+                    other.mBitNum);
+    const s32 num = std::min(mWordNum, other.mWordNum);
+    for (s32 i = 0; i < num; ++i)
+        mWords[i] &= other.mWords[i];
+}
+
+void BitArray::andNotWith(const BitArray& other)
+{
+    SEAD_ASSERT_MSG(mBitNum == other.mBitNum, "size mismatch [%d != %d]", mBitNum,
+                    other.mBitNum);
+    const s32 num = std::min(mWordNum, other.mWordNum);
+    for (s32 i = 0; i < num; ++i)
+        mWords[i] &= ~other.mWords[i];
+}
+
+void BitArray::xorWith(const BitArray& other)
+{
+    SEAD_ASSERT_MSG(mBitNum == other.mBitNum, "size mismatch [%d != %d]", mBitNum,
+                    other.mBitNum);
+    const s32 num = std::min(mWordNum, other.mWordNum);
+    for (s32 i = 0; i < num; ++i)
+        mWords[i] ^= other.mWords[i];
+}
+
+s32 BitArray::countOnBit(const Word* words, s32 word_num)
+{
+    s32 i = 0;
+    u64 count = 0;
+
+#if defined(SEAD_MATH_SIMD_NEON)
+    // Per-byte counts, accumulated in bytes for up to 31 iterations (31 * 8 < 256).
+    uint64x2_t total = vdupq_n_u64(0);
+    while (i + 2 <= word_num)
+    {
+        const s32 end = std::min(word_num, i + 2 * 31);
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (; i + 2 <= end; i += 2)
+            acc = vaddq_u8(acc, vcntq_u8(vreinterpretq_u8_u64(vld1q_u64(words + i))));
+        total = vaddq_u64(total, vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(acc))));
+    }
+    count = vgetq_lane_u64(total, 0) + vgetq_lane_u64(total, 1);
+#elif defined(SEAD_BIT_ARRAY_SSSE3)
+    // Without a popcount instruction: look up the counts of both nibbles of every byte with a
+    // shuffle, then sum the bytes with psadbw.
+    const __m128i lookup = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i low_mask = _mm_set1_epi8(0x0f);
+    __m128i total = _mm_setzero_si128();
+    for (; i + 2 <= word_num; i += 2)
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+        const __m128i lo = _mm_shuffle_epi8(lookup, _mm_and_si128(v, low_mask));
+        const __m128i hi =
+            _mm_shuffle_epi8(lookup, _mm_and_si128(_mm_srli_epi16(v, 4), low_mask));
+        total = _mm_add_epi64(total, _mm_sad_epu8(_mm_add_epi8(lo, hi), _mm_setzero_si128()));
+    }
+    count = u64(_mm_cvtsi128_si64(total)) +
+            u64(_mm_cvtsi128_si64(_mm_unpackhi_epi64(total, total)));
+#else
+    // Hardware popcount (or the compiler's fallback), on independent accumulators.
+    u64 counts[4] = {};
+    for (; i + 4 <= word_num; i += 4)
+    {
+        counts[0] += __builtin_popcountll(words[i]);
+        counts[1] += __builtin_popcountll(words[i + 1]);
+        counts[2] += __builtin_popcountll(words[i + 2]);
+        counts[3] += __builtin_popcountll(words[i + 3]);
+    }
+    count = counts[0] + counts[1] + counts[2] + counts[3];
+#endif
+
+    for (; i < word_num; ++i)
+        count += __builtin_popcountll(words[i]);
+    return s32(count);
+}
+
+s32 BitArray::findOnBit(s32 bit) const
+{
+    if (u32(bit) >= u32(mBitNum))
+        return -1;
+
+    s32 i = bit / cBitsPerWord;
+    Word word = mWords[i] & (~Word(0) << (bit % cBitsPerWord));
+    while (word == 0)
+    {
+        if (++i >= mWordNum)
+            return -1;
+        word = mWords[i];
+    }
+    return i * cBitsPerWord + __builtin_ctzll(word);
+}
+
+s32 BitArray::findOffBit(s32 bit) const
+{
+    if (u32(bit) >= u32(mBitNum))
+        return -1;
+
+    s32 i = bit / cBitsPerWord;
+    Word word = ~mWords[i] & (~Word(0) << (bit % cBitsPerWord));
+    while (word == 0)
+    {
+        if (++i >= mWordNum)
+            return -1;
+        word = ~mWords[i];
+    }
+    // The bits past the end are zero, so they look free: check the result.
+    const s32 result = i * cBitsPerWord + __builtin_ctzll(word);
+    return result < mBitNum ? result : -1;
+}
+
+void BitArray::updateRankIndex()
+{
+    u32 count = 0;
+    s32 block = 0;
+    for (s32 i = 0; i < mWordNum; i += cWordsPerRankBlock, ++block)
+    {
+        mRankIndex[block] = count;
+        count += countOnBit(mWords + i, std::min(cWordsPerRankBlock, mWordNum - i));
+    }
+    mRankIndex[block] = count;
+}
+
+s32 BitArray::rank(s32 bit) const
+{
+    SEAD_ASSERT_MSG(u32(bit) <= u32(mBitNum), "range over [0,%d] : %d", mBitNum, bit);
+
+    const s32 word_index = bit / cBitsPerWord;
+    const s32 block_begin = word_index - word_index % cWordsPerRankBlock;
+    s32 count = s32(mRankIndex[word_index / cWordsPerRankBlock]);
+    count += countOnBit(mWords + block_begin, word_index - block_begin);
+    if (bit % cBitsPerWord != 0)
+        count += __builtin_popcountll(mWords[word_index] & (makeMask(bit) - 1));
+    return count;
+}
+
+s32 BitArray::select(s32 n) const
+{
+    const s32 block_num = (mWordNum + cWordsPerRankBlock - 1) / cWordsPerRankBlock;
+    if (n < 0 || u32(n) >= mRankIndex[block_num])
+        return -1;
+
+    // Last block with fewer than n + 1 set bits before it.
+    const u32* block = std::upper_bound(mRankIndex, mRankIndex + block_num, u32(n)) - 1;
+    s32 remaining = n - s32(*block);
+    for (s32 i = s32(block - mRankIndex) * cWordsPerRankBlock; i < mWordNum; ++i)
+    {
+        const s32 word_count = __builtin_popcountll(mWords[i]);
+        if (remaining < word_count)
+            return i * cBitsPerWord + BitFlagUtil::findOnBitFromRight64(mWords[i], remaining + 1);
+        remaining -= word_count;
+    }
+
+    SEAD_ASSERT_MSG(false, "the rank index is out of date; call updateRankIndex()");
+    return -1;
+}
+
+}  // namespace sead
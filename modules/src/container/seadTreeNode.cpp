@@ -198,4 +198,14 @@ void TreeNode::pushFrontChild(TreeNode* node)
         node->mPrev = node;
     }
 }
+
+s32 TreeNode::copySubTreeTo(TreeNode** dst, s32 num_max)
+{
+    s32 num = 0;
+    forEachSubTreeNode([dst, num_max, &num](TreeNode* node) {
+        if (num < num_max)
+            dst[num++] = node;
+    });
+    return num;
+}
 }  // namespace sead
@@ -11,6 +11,8 @@
 
 #include <basis/seadNew.h>
 #include <basis/seadRawPrint.h>
+#include <codec/seadHashCRC32.h>
+#include <cstring>
 #include <devenv/seadEnvUtil.h>
 #include <filedevice/seadFileDeviceMgr.h>
 #include <filedevice/seadPath.h>
@@ -161,7 +163,7 @@ void FileDeviceMgr::unmount_()
 void FileDeviceMgr::traceFilePath(const SafeString& path) const
 {
     SEAD_DEBUG_PRINT("[FileDeviceMgr] %s\n", path.cstr());
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
 
     if (device != NULL)
@@ -173,7 +175,7 @@ void FileDeviceMgr::traceFilePath(const SafeString& path) const
 void FileDeviceMgr::traceDirectoryPath(const SafeString& path) const
 {
     SEAD_DEBUG_PRINT("[FileDeviceMgr] %s\n", path.cstr());
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
 
     if (device != NULL)
@@ -184,7 +186,7 @@ void FileDeviceMgr::traceDirectoryPath(const SafeString& path) const
 
 void FileDeviceMgr::resolveFilePath(BufferedSafeString* out, const SafeString& path) const
 {
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
 
     if (device != NULL)
@@ -195,7 +197,7 @@ void FileDeviceMgr::resolveFilePath(BufferedSafeString* out, const SafeString& p
 
 void FileDeviceMgr::resolveDirectoryPath(BufferedSafeString* out, const SafeString& path) const
 {
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
 
     if (device != NULL)
@@ -210,11 +212,13 @@ void FileDeviceMgr::mount(FileDevice* device, const SafeString& name)
         device->setDriveName(name);
 
     mDeviceList.pushBack(device);
+    insertDeviceSlot_(device);
 }
 
 void FileDeviceMgr::unmount(FileDevice* device)
 {
     mDeviceList.erase(device);
+    rebuildDeviceTable_();
 
     if (device == mDefaultFileDevice)
         mDefaultFileDevice = NULL;
@@ -258,19 +262,122 @@ FileDevice* FileDeviceMgr::findDeviceFromPath(const SafeString& path,
     return device;
 }
 
+FileDevice* FileDeviceMgr::findDeviceFromPath(const SafeString& path, SafeString* pathNoDrive) const
+{
+    const s32 driveNameLength = Path::getDriveNameLength(path);
+    FileDevice* device;
+
+    if (driveNameLength == -1)
+    {
+        device = mDefaultFileDevice;
+        if (!device)
+        {
+            SEAD_ASSERT_MSG(false, "drive name not found and default file device is null");
+            return nullptr;
+        }
+    }
+    else
+        device = findDevice(path.cstr(), driveNameLength);
+
+    if (!device)
+        return nullptr;
+
+    if (pathNoDrive != NULL)
+        *pathNoDrive = Path::getPathExceptDrive(path);
+
+    return device;
+}
+
 FileDevice* FileDeviceMgr::findDevice(const SafeString& name) const
+{
+    return findDevice(name.cstr(), name.calcLength());
+}
+
+namespace
+{
+u32 calcDriveNameHash(const char* name, s32 length)
+{
+    return HashCRC32::calcHash(name, length);
+}
+
+bool isDriveNameEqual(const FileDevice* device, const char* name, s32 length)
+{
+    const SafeString& driveName = device->getDriveName();
+    return driveName.calcLength() == length && std::strncmp(driveName.cstr(), name, length) == 0;
+}
+}  // namespace
+
+FileDevice* FileDeviceMgr::findDevice(const char* name, s32 length) const
+{
+    const u32 hash = calcDriveNameHash(name, length);
+    const u32 mask = cDeviceTableSize - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        const DeviceSlot& entry = mDeviceTable(slot);
+        if (!entry.device)
+            break;
+
+        if (entry.hash == hash && isDriveNameEqual(entry.device, name, length))
+            return entry.device;
+    }
+
+    // Devices that could not be inserted (table full) or that were renamed after being mounted
+    // are only found by the linear search.
+    return searchDeviceList_(name, length);
+}
+
+FileDevice* FileDeviceMgr::searchDeviceList_(const char* name, s32 length) const
 {
     for (auto it = mDeviceList.begin(); it != mDeviceList.end(); ++it)
-        if ((*it)->getDriveName() == name)
+        if (isDriveNameEqual(*it, name, length))
             return *it;
 
     return nullptr;
 }
 
+void FileDeviceMgr::insertDeviceSlot_(FileDevice* device)
+{
+    // Keep the load factor at or below 1/2.
+    if (mNumDeviceSlots * 2 >= cDeviceTableSize)
+        return;
+
+    const SafeString& name = device->getDriveName();
+    const s32 length = name.calcLength();
+    const u32 hash = calcDriveNameHash(name.cstr(), length);
+    const u32 mask = cDeviceTableSize - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        DeviceSlot& entry = mDeviceTable(slot);
+        if (!entry.device)
+        {
+            entry.hash = hash;
+            entry.device = device;
+            ++mNumDeviceSlots;
+            return;
+        }
+
+        // The device that was mounted first wins.
+        if (entry.hash == hash && isDriveNameEqual(entry.device, name.cstr(), length))
+            return;
+    }
+}
+
+void FileDeviceMgr::rebuildDeviceTable_()
+{
+    DeviceSlot empty;
+    empty.hash = 0;
+    empty.device = nullptr;
+    mDeviceTable.fill(empty);
+    mNumDeviceSlots = 0;
+
+    for (auto it = mDeviceList.begin(); it != mDeviceList.end(); ++it)
+        insertDeviceSlot_(*it);
+}
+
 FileDevice* FileDeviceMgr::tryOpen(FileHandle* handle, const SafeString& path,
                                    FileDevice::FileOpenFlag flag, u32 divSize)
 {
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
 
     if (device == NULL)
@@ -281,7 +388,7 @@ FileDevice* FileDeviceMgr::tryOpen(FileHandle* handle, const SafeString& path,
 
 FileDevice* FileDeviceMgr::tryOpenDirectory(DirectoryHandle* handle, const SafeString& path)
 {
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(path, &pathNoDrive);
     if (!device)
         return nullptr;
@@ -296,7 +403,7 @@ u8* FileDeviceMgr::tryLoad(FileDevice::LoadArg& arg)
 {
     SEAD_ASSERT_MSG(arg.path != SafeString::cEmptyString, "path is null");
 
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(arg.path, &pathNoDrive);
 
     if (device == NULL)
@@ -325,7 +432,7 @@ bool FileDeviceMgr::trySave(FileDevice::SaveArg& arg)
 {
     SEAD_ASSERT_MSG(arg.path != SafeString::cEmptyString, "path is null");
 
-    FixedSafeString<256> pathNoDrive;
+    SafeString pathNoDrive;
     FileDevice* device = findDeviceFromPath(arg.path, &pathNoDrive);
     if (!device)
         return false;
@@ -0,0 +1,382 @@
+#include "filedevice/seadOverlayFileDevice.h"
+#include "basis/seadRawPrint.h"
+#include "codec/seadHashCRC32.h"
+#include "heap/seadHeap.h"
+
+namespace sead
+{
+OverlayFileDevice::OverlayFileDevice() : FileDevice("overlay") {}
+
+OverlayFileDevice::~OverlayFileDevice()
+{
+    freeBuffer();
+}
+
+void OverlayFileDevice::allocBuffer(s32 max_layers, s32 max_files, Heap* heap)
+{
+    SEAD_ASSERT(!isBufferReady());
+
+    // Keep the load factor at or below 1/2.
+    s32 capacity = 1;
+    while (capacity < max_files * 2)
+        capacity <<= 1;
+
+    mLayers.allocBuffer(max_layers, heap);
+    mIndex.allocBuffer(capacity, heap);
+    clearLayers();
+}
+
+void OverlayFileDevice::freeBuffer()
+{
+    mLayers.freeBuffer();
+    mIndex.freeBuffer();
+    mNumLayers = 0;
+    mNumIndexed = 0;
+}
+
+bool OverlayFileDevice::addLayer(FileDevice* device)
+{
+    if (!device || device == this)
+    {
+        SEAD_ASSERT_MSG(false, "invalid device");
+        return false;
+    }
+
+    if (mNumLayers >= mLayers.size())
+    {
+        SEAD_ASSERT_MSG(false, "layer buffer full [%d]", mLayers.size());
+        return false;
+    }
+
+    const s32 layer = mNumLayers++;
+    mLayers(layer) = device;
+
+    if (!indexLayer_(layer, "", 0))
+    {
+        SEAD_WARN("failed to index layer [%s]", device->getDriveName().cstr());
+        --mNumLayers;
+        rebuildIndex_();
+        return false;
+    }
+
+    return true;
+}
+
+bool OverlayFileDevice::removeLayer(FileDevice* device)
+{
+    for (s32 i = 0; i < mNumLayers; ++i)
+    {
+        if (mLayers(i) != device)
+            continue;
+
+        for (s32 j = i + 1; j < mNumLayers; ++j)
+            mLayers(j - 1) = mLayers(j);
+        --mNumLayers;
+
+        return rebuildIndex_();
+    }
+
+    SEAD_WARN("layer not found [%s]", device ? device->getDriveName().cstr() : "null");
+    return false;
+}
+
+void OverlayFileDevice::clearLayers()
+{
+    mNumLayers = 0;
+    rebuildIndex_();
+}
+
+FileDevice* OverlayFileDevice::findLayer(const SafeString& path)
+{
+    s32 layer = searchIndex_(path);
+    if (layer < 0)
+        return nullptr;
+
+    bool exists = false;
+    if (mLayers(layer)->tryIsExistFile(&exists, path) && exists)
+        return mLayers(layer);
+
+    layer = resolveCollision_(path, layer);
+    return layer < 0 ? nullptr : mLayers(layer);
+}
+
+void OverlayFileDevice::resolveFilePath(BufferedSafeString* out, const SafeString& path) const
+{
+    const s32 layer = searchIndex_(path);
+    if (layer < 0)
+    {
+        out->copy(path);
+        return;
+    }
+
+    mLayers(layer)->resolveFilePath(out, path);
+}
+
+bool OverlayFileDevice::isMatchDevice_(const HandleBase* handle) const
+{
+    return findHandleLayer_(handle) != nullptr;
+}
+
+u8* OverlayFileDevice::doLoad_(LoadArg& arg)
+{
+    s32 layer = searchIndex_(arg.path);
+    if (layer < 0)
+        return nullptr;
+
+    u8* data = mLayers(layer)->tryLoad(arg);
+    if (data)
+        return data;
+
+    layer = resolveCollision_(arg.path, layer);
+    if (layer < 0)
+        return nullptr;
+
+    return mLayers(layer)->tryLoad(arg);
+}
+
+FileDevice* OverlayFileDevice::doOpen_(FileHandle* handle, const SafeString& path,
+                                       FileOpenFlag flag)
+{
+    if (flag != cFileOpenFlag_ReadOnly)
+    {
+        SEAD_WARN("overlay device is read only [%s]", path.cstr());
+        return nullptr;
+    }
+
+    s32 layer = searchIndex_(path);
+    if (layer < 0)
+        return nullptr;
+
+    FileDevice* device = mLayers(layer)->tryOpen(handle, path, flag, handle->getDivSize());
+    if (device)
+        return device;
+
+    layer = resolveCollision_(path, layer);
+    if (layer < 0)
+        return nullptr;
+
+    return mLayers(layer)->tryOpen(handle, path, flag, handle->getDivSize());
+}
+
+bool OverlayFileDevice::doClose_(FileHandle* handle)
+{
+    return findHandleLayer_(handle)->tryClose(handle);
+}
+
+bool OverlayFileDevice::doFlush_(FileHandle*)
+{
+    SEAD_ASSERT_MSG(false, "not supported");
+    return false;
+}
+
+bool OverlayFileDevice::doRemove_(const SafeString&)
+{
+    SEAD_ASSERT_MSG(false, "not supported");
+    return false;
+}
+
+bool OverlayFileDevice::doRead_(u32* bytesRead, FileHandle* handle, u8* outBuffer,
+                                u32 bytesToRead)
+{
+    return findHandleLayer_(handle)->tryRead(bytesRead, handle, outBuffer, bytesToRead);
+}
+
+bool OverlayFileDevice::doSeek_(FileHandle* handle, s32 offset, SeekOrigin origin)
+{
+    return findHandleLayer_(handle)->trySeek(handle, offset, origin);
+}
+
+bool OverlayFileDevice::doGetCurrentSeekPos_(u32* seekPos, FileHandle* handle)
+{
+    return findHandleLayer_(handle)->tryGetCurrentSeekPos(seekPos, handle);
+}
+
+bool OverlayFileDevice::doGetFileSize_(u32* fileSize, const SafeString& path)
+{
+    s32 layer = searchIndex_(path);
+    if (layer < 0)
+        return false;
+
+    if (mLayers(layer)->tryGetFileSize(fileSize, path))
+        return true;
+
+    layer = resolveCollision_(path, layer);
+    if (layer < 0)
+        return false;
+
+    return mLayers(layer)->tryGetFileSize(fileSize, path);
+}
+
+bool OverlayFileDevice::doGetFileSize_(u32* fileSize, FileHandle* handle)
+{
+    return findHandleLayer_(handle)->tryGetFileSize(fileSize, handle);
+}
+
+bool OverlayFileDevice::doIsExistFile_(bool* exists, const SafeString& path)
+{
+    *exists = findLayer(path) != nullptr;
+    return true;
+}
+
+bool OverlayFileDevice::doIsExistDirectory_(bool* exists, const SafeString& path)
+{
+    for (s32 i = mNumLayers - 1; i >= 0; --i)
+    {
+        if (mLayers(i)->tryIsExistDirectory(exists, path) && *exists)
+            return true;
+    }
+
+    *exists = false;
+    return true;
+}
+
+FileDevice* OverlayFileDevice::doOpenDirectory_(DirectoryHandle* handle, const SafeString& path)
+{
+    for (s32 i = mNumLayers - 1; i >= 0; --i)
+    {
+        if (FileDevice* device = mLayers(i)->tryOpenDirectory(handle, path))
+            return device;
+    }
+
+    return nullptr;
+}
+
+bool OverlayFileDevice::doCloseDirectory_(DirectoryHandle* handle)
+{
+    return findHandleLayer_(handle)->tryCloseDirectory(handle);
+}
+
+bool OverlayFileDevice::doReadDirectory_(u32* entriesRead, DirectoryHandle* handle,
+                                         DirectoryEntry* entries, u32 entriesToRead)
+{
+    return findHandleLayer_(handle)->tryReadDirectory(entriesRead, handle, entries,
+                                                       entriesToRead);
+}
+
+s32 OverlayFileDevice::searchIndex_(const SafeString& path) const
+{
+    if (mNumIndexed == 0)
+        return -1;
+
+    const u32 hash = HashCRC32::calcStringHash(path);
+    const u32 mask = mIndex.size() - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        const IndexEntry& entry = mIndex(slot);
+        if (entry.layer < 0)
+            return -1;
+
+        if (entry.hash == hash)
+            return entry.layer;
+    }
+}
+
+s32 OverlayFileDevice::resolveCollision_(const SafeString& path, s32 layer)
+{
+    bool exists = false;
+    if (mLayers(layer)->tryIsExistFile(&exists, path) && exists)
+        return -1;
+
+    for (s32 i = layer - 1; i >= 0; --i)
+    {
+        if (mLayers(i)->tryIsExistFile(&exists, path) && exists)
+            return i;
+    }
+
+    return -1;
+}
+
+FileDevice* OverlayFileDevice::findHandleLayer_(const HandleBase* handle) const
+{
+    for (s32 i = 0; i < mNumLayers; ++i)
+    {
+        if (mLayers(i)->isMatchDevice_(handle))
+            return mLayers(i);
+    }
+
+    return nullptr;
+}
+
+bool OverlayFileDevice::insertIndex_(u32 hash, s32 layer)
+{
+    const u32 mask = mIndex.size() - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask)
+    {
+        IndexEntry& entry = mIndex(slot);
+        if (entry.layer < 0)
+        {
+            if (mNumIndexed * 2 >= mIndex.size())
+            {
+                SEAD_ASSERT_MSG(false, "index full [%d]", mIndex.size() / 2);
+                return false;
+            }
+
+            entry.hash = hash;
+            entry.layer = layer;
+            ++mNumIndexed;
+            return true;
+        }
+
+        if (entry.hash == hash)
+        {
+            // Layers are indexed from bottom to top, so the later layer wins.
+            entry.layer = layer;
+            return true;
+        }
+    }
+}
+
+bool OverlayFileDevice::indexLayer_(s32 layer, const SafeString& dir, s32 depth)
+{
+    if (depth > cEnumerateDepthMax)
+    {
+        SEAD_WARN("directory too deep [%s]", dir.cstr());
+        return false;
+    }
+
+    FileDevice* device = mLayers(layer);
+    DirectoryHandle handle;
+    if (!device->tryOpenDirectory(&handle, dir))
+        return false;
+
+    constexpr u32 cEntryBatch = 4;
+    DirectoryEntry entries[cEntryBatch];
+    FixedSafeString<256> path;
+    bool ok = true;
+
+    u32 num = 0;
+    while (ok && device->tryReadDirectory(&num, &handle, entries, cEntryBatch) && num != 0)
+    {
+        for (u32 i = 0; i < num && ok; ++i)
+        {
+            if (dir.isEmpty())
+                path.copy(entries[i].name);
+            else
+                path.format("%s/%s", dir.cstr(), entries[i].name.cstr());
+
+            if (entries[i].is_directory)
+                ok = indexLayer_(layer, path, depth + 1);
+            else
+                ok = insertIndex_(HashCRC32::calcStringHash(path), layer);
+        }
+    }
+
+    device->tryCloseDirectory(&handle);
+    return ok;
+}
+
+bool OverlayFileDevice::rebuildIndex_()
+{
+    IndexEntry empty;
+    empty.hash = 0;
+    empty.layer = -1;
+    mIndex.fill(empty);
+    mNumIndexed = 0;
+
+    bool ok = true;
+    for (s32 i = 0; i < mNumLayers; ++i)
+        ok &= indexLayer_(i, "", 0);
+
+    return ok;
+}
+}  // namespace sead
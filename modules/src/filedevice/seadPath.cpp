@@ -31,6 +31,20 @@ void Path::getPathExceptDrive(BufferedSafeString* pathNoDrive, const SafeString&
         pathNoDrive->copyAt(0, path.getPart(index + 3));
 }
 
+SafeString Path::getPathExceptDrive(const SafeString& path)
+{
+    const s32 index = path.findIndex("://");
+    if (index == -1)
+        return path;
+
+    return path.getPart(index + 3);
+}
+
+s32 Path::getDriveNameLength(const SafeString& path)
+{
+    return path.findIndex(":");
+}
+
 namespace
 {
 s32 rfindCharIndex(const SafeString& path, char c)
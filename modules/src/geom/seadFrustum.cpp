@@ -0,0 +1,287 @@
+#include "geom/seadFrustum.h"
+#include "basis/seadRawPrint.h"
+#include "gfx/seadCamera.h"
+#include "gfx/seadProjection.h"
+#include "math/seadMathCalcCommon.h"
+
+namespace sead
+{
+namespace
+{
+// Plane coefficients, splatted once per batch for the SIMD path.
+struct FrustumPlanes
+{
+    explicit FrustumPlanes(const Frustum& frustum)
+    {
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+        {
+            const Vector4f& plane = frustum.getPlane(static_cast<Frustum::Plane>(p));
+            a[p] = plane.x;
+            b[p] = plane.y;
+            c[p] = plane.z;
+            d[p] = plane.w;
+#ifdef SEAD_MATH_SIMD
+            va[p] = detail::simdSplat(plane.x);
+            vb[p] = detail::simdSplat(plane.y);
+            vc[p] = detail::simdSplat(plane.z);
+            vd[p] = detail::simdSplat(plane.w);
+#endif
+        }
+    }
+
+    f32 calcDistance(s32 p, f32 x, f32 y, f32 z) const
+    {
+        return a[p] * x + b[p] * y + c[p] * z + d[p];
+    }
+
+#ifdef SEAD_MATH_SIMD
+    detail::F32x4 calcDistance(s32 p, detail::F32x4 x, detail::F32x4 y, detail::F32x4 z) const
+    {
+        using namespace detail;
+        return simdAdd(simdAdd(simdAdd(simdMul(va[p], x), simdMul(vb[p], y)), simdMul(vc[p], z)),
+                       vd[p]);
+    }
+
+    detail::F32x4 va[Frustum::cPlane_Num];
+    detail::F32x4 vb[Frustum::cPlane_Num];
+    detail::F32x4 vc[Frustum::cPlane_Num];
+    detail::F32x4 vd[Frustum::cPlane_Num];
+#endif
+
+    f32 a[Frustum::cPlane_Num];
+    f32 b[Frustum::cPlane_Num];
+    f32 c[Frustum::cPlane_Num];
+    f32 d[Frustum::cPlane_Num];
+};
+
+// A sphere intersects if its center is not further than its radius outside any plane.
+struct SphereTest
+{
+    bool test(s32 i) const
+    {
+        f32 v = Mathf::maxNumber();
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+            v = Mathf::min(v, planes.calcDistance(p, s.x[i], s.y[i], s.z[i]) + s.radius[i]);
+        return v >= 0;
+    }
+
+#ifdef SEAD_MATH_SIMD
+    detail::F32x4 test4(s32 i) const
+    {
+        using namespace detail;
+        const F32x4 x = simdLoad(s.x + i);
+        const F32x4 y = simdLoad(s.y + i);
+        const F32x4 z = simdLoad(s.z + i);
+        const F32x4 r = simdLoad(s.radius + i);
+
+        F32x4 v = simdSplat(Mathf::maxNumber());
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+            v = simdMin(v, simdAdd(planes.calcDistance(p, x, y, z), r));
+        return simdCmpGe(v, simdSplat(0.0f));
+    }
+#endif
+
+    const FrustumPlanes& planes;
+    const SphereStream& s;
+};
+
+// A box intersects if, for every plane, its corner furthest along the plane normal is on the
+// inner side. The corner only depends on the signs of the normal, so it is selected once per
+// plane by picking the min or max stream of each axis.
+struct BoxTest
+{
+    BoxTest(const FrustumPlanes& planes_, const BoxStream& b) : planes(planes_)
+    {
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+        {
+            x[p] = planes.a[p] >= 0 ? b.max_x : b.min_x;
+            y[p] = planes.b[p] >= 0 ? b.max_y : b.min_y;
+            z[p] = planes.c[p] >= 0 ? b.max_z : b.min_z;
+        }
+    }
+
+    bool test(s32 i) const
+    {
+        f32 v = Mathf::maxNumber();
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+            v = Mathf::min(v, planes.calcDistance(p, x[p][i], y[p][i], z[p][i]));
+        return v >= 0;
+    }
+
+#ifdef SEAD_MATH_SIMD
+    detail::F32x4 test4(s32 i) const
+    {
+        using namespace detail;
+        F32x4 v = simdSplat(Mathf::maxNumber());
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+        {
+            v = simdMin(v, planes.calcDistance(p, simdLoad(x[p] + i), simdLoad(y[p] + i),
+                                               simdLoad(z[p] + i)));
+        }
+        return simdCmpGe(v, simdSplat(0.0f));
+    }
+#endif
+
+    const FrustumPlanes& planes;
+    const f32* x[Frustum::cPlane_Num];
+    const f32* y[Frustum::cPlane_Num];
+    const f32* z[Frustum::cPlane_Num];
+};
+
+// An oriented box intersects if the distance of its center to every plane is not less than
+// minus the projection of its half extents onto the plane normal.
+struct OrientedBoxTest
+{
+    bool test(s32 i) const
+    {
+        const auto& m = b.m;
+        f32 v = Mathf::maxNumber();
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+        {
+            const f32 center = planes.calcDistance(p, m[0][3][i], m[1][3][i], m[2][3][i]);
+            const f32 ex = Mathf::abs(planes.a[p] * m[0][0][i] + planes.b[p] * m[1][0][i] +
+                                      planes.c[p] * m[2][0][i]);
+            const f32 ey = Mathf::abs(planes.a[p] * m[0][1][i] + planes.b[p] * m[1][1][i] +
+                                      planes.c[p] * m[2][1][i]);
+            const f32 ez = Mathf::abs(planes.a[p] * m[0][2][i] + planes.b[p] * m[1][2][i] +
+                                      planes.c[p] * m[2][2][i]);
+            v = Mathf::min(v, center + ex + ey + ez);
+        }
+        return v >= 0;
+    }
+
+#ifdef SEAD_MATH_SIMD
+    detail::F32x4 test4(s32 i) const
+    {
+        using namespace detail;
+        F32x4 col[4][3];
+        for (s32 c = 0; c < 4; ++c)
+        {
+            for (s32 r = 0; r < 3; ++r)
+                col[c][r] = simdLoad(b.m[r][c] + i);
+        }
+
+        F32x4 v = simdSplat(Mathf::maxNumber());
+        for (s32 p = 0; p < Frustum::cPlane_Num; ++p)
+        {
+            const F32x4 center = planes.calcDistance(p, col[3][0], col[3][1], col[3][2]);
+            F32x4 e[3];
+            for (s32 c = 0; c < 3; ++c)
+            {
+                e[c] = simdAbs(simdAdd(
+                    simdAdd(simdMul(planes.va[p], col[c][0]), simdMul(planes.vb[p], col[c][1])),
+                    simdMul(planes.vc[p], col[c][2])));
+            }
+            v = simdMin(v, simdAdd(simdAdd(simdAdd(center, e[0]), e[1]), e[2]));
+        }
+        return simdCmpGe(v, simdSplat(0.0f));
+    }
+#endif
+
+    const FrustumPlanes& planes;
+    const OrientedBoxStream& b;
+};
+}  // namespace
+
+void Frustum::set(const Camera& camera, const Projection& projection)
+{
+    Matrix44f clip_mtx;
+    clip_mtx.setMul(projection.getProjectionMatrix(), camera.getMatrix());
+    set(clip_mtx);
+}
+
+void Frustum::set(const Matrix44f& clip_mtx)
+{
+    // Gribb and Hartmann: -w <= x is (row 3 + row 0) . p >= 0, x <= w is (row 3 - row 0) . p >= 0
+    // and so on for y and z.
+    const auto& m = clip_mtx.m;
+    for (s32 i = 0; i < 3; ++i)
+    {
+        setPlane(static_cast<Plane>(i * 2),
+                 Vector4f(m[3][0] + m[i][0], m[3][1] + m[i][1], m[3][2] + m[i][2],
+                          m[3][3] + m[i][3]));
+        setPlane(static_cast<Plane>(i * 2 + 1),
+                 Vector4f(m[3][0] - m[i][0], m[3][1] - m[i][1], m[3][2] - m[i][2],
+                          m[3][3] - m[i][3]));
+    }
+}
+
+void Frustum::setPlane(Plane index, const Vector4f& plane)
+{
+    const f32 len = Mathf::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+    SEAD_ASSERT_MSG(len > 0, "degenerate plane [%d]", index);
+    const f32 inv = len > 0 ? 1.0f / len : 0.0f;
+    mPlanes[index] = Vector4f(plane.x * inv, plane.y * inv, plane.z * inv, plane.w * inv);
+}
+
+bool Frustum::isInside(const Vector3f& p) const
+{
+    for (s32 i = 0; i < cPlane_Num; ++i)
+    {
+        if (calcDistance_(static_cast<Plane>(i), p.x, p.y, p.z) < 0)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::isIntersectSphere(const Vector3f& center, f32 radius) const
+{
+    for (s32 i = 0; i < cPlane_Num; ++i)
+    {
+        if (calcDistance_(static_cast<Plane>(i), center.x, center.y, center.z) + radius < 0)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::isIntersectBox(const BoundBox3f& box) const
+{
+    const Vector3f& min = box.getMin();
+    const Vector3f& max = box.getMax();
+    for (s32 i = 0; i < cPlane_Num; ++i)
+    {
+        const Vector4f& p = mPlanes[i];
+        if (calcDistance_(static_cast<Plane>(i), p.x >= 0 ? max.x : min.x,
+                          p.y >= 0 ? max.y : min.y, p.z >= 0 ? max.z : min.z) < 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Frustum::isIntersectOrientedBox(const Matrix34f& box) const
+{
+    const auto& m = box.m;
+    for (s32 i = 0; i < cPlane_Num; ++i)
+    {
+        const Vector4f& p = mPlanes[i];
+        const f32 center = calcDistance_(static_cast<Plane>(i), m[0][3], m[1][3], m[2][3]);
+        const f32 ex = Mathf::abs(p.x * m[0][0] + p.y * m[1][0] + p.z * m[2][0]);
+        const f32 ey = Mathf::abs(p.x * m[0][1] + p.y * m[1][1] + p.z * m[2][1]);
+        const f32 ez = Mathf::abs(p.x * m[0][2] + p.y * m[1][2] + p.z * m[2][2]);
+        if (center + ex + ey + ez < 0)
+            return false;
+    }
+    return true;
+}
+
+void Frustum::cullSpheres(u32* mask, const SphereStream& spheres, s32 num) const
+{
+    const FrustumPlanes planes(*this);
+    CullMask::build(mask, num, SphereTest{planes, spheres});
+}
+
+void Frustum::cullBoxes(u32* mask, const BoxStream& boxes, s32 num) const
+{
+    const FrustumPlanes planes(*this);
+    CullMask::build(mask, num, BoxTest(planes, boxes));
+}
+
+void Frustum::cullOrientedBoxes(u32* mask, const OrientedBoxStream& boxes, s32 num) const
+{
+    const FrustumPlanes planes(*this);
+    CullMask::build(mask, num, OrientedBoxTest{planes, boxes});
+}
+
+}  // namespace sead
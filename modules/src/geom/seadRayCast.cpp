@@ -0,0 +1,100 @@
+#include "geom/seadRayCast.h"
+#include "prim/seadBitUtil.h"
+
+namespace sead
+{
+namespace
+{
+// Slab test. The entry (near) and exit (far) planes of each slab only depend on the sign of the
+// ray direction, so they are selected once per ray by picking the min or max stream of each
+// axis, and the loop only has to compute six distances and reduce them with min and max.
+struct RayBoxTest
+{
+    RayBoxTest(const Ray<Vector3f>& ray, const BoxStream& b, f32 max_dist_)
+        : max_dist(max_dist_)
+    {
+        const f32* const min[3] = {b.min_x, b.min_y, b.min_z};
+        const f32* const max[3] = {b.max_x, b.max_y, b.max_z};
+        for (s32 i = 0; i < 3; ++i)
+        {
+            const f32 dir = ray.getDir().e[i];
+            // A huge finite value instead of infinity avoids 0 * inf = NaN when the ray origin
+            // lies on a slab plane that is parallel to the ray.
+            if (dir != 0)
+                inv_dir[i] = 1.0f / dir;
+            else
+                inv_dir[i] = BitUtil::bitCast<u32>(dir) >> 31 ? -Mathf::maxNumber() :
+                                                                 Mathf::maxNumber();
+
+            origin[i] = ray.getPos().e[i];
+            near[i] = inv_dir[i] >= 0 ? min[i] : max[i];
+            far[i] = inv_dir[i] >= 0 ? max[i] : min[i];
+        }
+    }
+
+    bool test(s32 i, f32* t) const
+    {
+        f32 t_near = 0.0f;
+        f32 t_far = max_dist;
+        for (s32 a = 0; a < 3; ++a)
+        {
+            t_near = Mathf::max(t_near, (near[a][i] - origin[a]) * inv_dir[a]);
+            t_far = Mathf::min(t_far, (far[a][i] - origin[a]) * inv_dir[a]);
+        }
+        *t = t_near;
+        return t_far >= t_near;
+    }
+
+    bool test(s32 i) const
+    {
+        f32 t;
+        return test(i, &t);
+    }
+
+#ifdef SEAD_MATH_SIMD
+    detail::F32x4 test4(s32 i) const
+    {
+        using namespace detail;
+        F32x4 t_near = simdSplat(0.0f);
+        F32x4 t_far = simdSplat(max_dist);
+        for (s32 a = 0; a < 3; ++a)
+        {
+            const F32x4 o = simdSplat(origin[a]);
+            const F32x4 inv = simdSplat(inv_dir[a]);
+            t_near = simdMax(t_near, simdMul(simdSub(simdLoad(near[a] + i), o), inv));
+            t_far = simdMin(t_far, simdMul(simdSub(simdLoad(far[a] + i), o), inv));
+        }
+        return simdCmpGe(t_far, t_near);
+    }
+#endif
+
+    f32 origin[3];
+    f32 inv_dir[3];
+    f32 max_dist;
+    const f32* near[3];
+    const f32* far[3];
+};
+}  // namespace
+
+bool RayCast::intersectBox(f32* t, const Ray<Vector3f>& ray, const BoundBox3f& box, f32 max_dist)
+{
+    const Vector3f& min = box.getMin();
+    const Vector3f& max = box.getMax();
+    const BoxStream b = {&min.x, &min.y, &min.z, &max.x, &max.y, &max.z};
+
+    f32 t_near;
+    if (!RayBoxTest(ray, b, max_dist).test(0, &t_near))
+        return false;
+
+    if (t)
+        *t = t_near;
+    return true;
+}
+
+void RayCast::intersectBoxes(u32* mask, const Ray<Vector3f>& ray, const BoxStream& boxes, s32 num,
+                             f32 max_dist)
+{
+    CullMask::build(mask, num, RayBoxTest(ray, boxes, max_dist));
+}
+
+}  // namespace sead
@@ -0,0 +1,739 @@
+#include "math/seadBvh.h"
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "geom/seadFrustum.h"
+#include "mc/seadWorkerMgr.h"
+#include "prim/seadBitUtil.h"
+
+namespace sead
+{
+namespace
+{
+void setUnion(Vector3f* min, Vector3f* max, const Vector3f& other_min, const Vector3f& other_max)
+{
+    min->x = Mathf::min(min->x, other_min.x);
+    min->y = Mathf::min(min->y, other_min.y);
+    min->z = Mathf::min(min->z, other_min.z);
+    max->x = Mathf::max(max->x, other_max.x);
+    max->y = Mathf::max(max->y, other_max.y);
+    max->z = Mathf::max(max->z, other_max.z);
+}
+
+/// Half of the surface area of a box, which is all the heuristic needs.
+f32 calcHalfArea(const Vector3f& min, const Vector3f& max)
+{
+    const f32 dx = max.x - min.x;
+    const f32 dy = max.y - min.y;
+    const f32 dz = max.z - min.z;
+    return dx * dy + dy * dz + dz * dx;
+}
+
+bool isOverlap(const Vector3f& min, const Vector3f& max, const BoundBox3f& box)
+{
+    return min.x <= box.getMax().x && box.getMin().x <= max.x && min.y <= box.getMax().y &&
+           box.getMin().y <= max.y && min.z <= box.getMax().z && box.getMin().z <= max.z;
+}
+
+f32 calcSquaredDistance(const Vector3f& min, const Vector3f& max, const Vector3f& p)
+{
+    const f32 dx = Mathf::max(Mathf::max(min.x - p.x, p.x - max.x), 0.0f);
+    const f32 dy = Mathf::max(Mathf::max(min.y - p.y, p.y - max.y), 0.0f);
+    const f32 dz = Mathf::max(Mathf::max(min.z - p.z, p.z - max.z), 0.0f);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+// Slab test against many boxes with the same ray, as in RayCast.
+class RaySlab
+{
+public:
+    RaySlab(const Ray<Vector3f>& ray, f32 max_dist) : mMaxDist(max_dist)
+    {
+        for (s32 i = 0; i < 3; ++i)
+        {
+            const f32 dir = ray.getDir().e[i];
+            if (dir != 0)
+                mInvDir[i] = 1.0f / dir;
+            else
+                mInvDir[i] = BitUtil::bitCast<u32>(dir) >> 31 ? -Mathf::maxNumber() :
+                                                                Mathf::maxNumber();
+            mOrigin[i] = ray.getPos().e[i];
+            mNegative[i] = mInvDir[i] < 0;
+        }
+    }
+
+    /// Returns the entry distance, or a negative value if the box is missed.
+    f32 test(const Vector3f& min, const Vector3f& max) const
+    {
+        f32 t_near = 0.0f;
+        f32 t_far = mMaxDist;
+        for (s32 i = 0; i < 3; ++i)
+        {
+            const f32 near = mNegative[i] ? max.e[i] : min.e[i];
+            const f32 far = mNegative[i] ? min.e[i] : max.e[i];
+            t_near = Mathf::max(t_near, (near - mOrigin[i]) * mInvDir[i]);
+            t_far = Mathf::min(t_far, (far - mOrigin[i]) * mInvDir[i]);
+        }
+        return t_far >= t_near ? t_near : -1.0f;
+    }
+
+    void setMaxDist(f32 max_dist) { mMaxDist = max_dist; }
+
+private:
+    f32 mOrigin[3];
+    f32 mInvDir[3];
+    bool mNegative[3];
+    f32 mMaxDist;
+};
+
+struct Bin
+{
+    s32 count;
+    Vector3f min;
+    Vector3f max;
+};
+}  // namespace
+
+Bvh::BuildArg::BuildArg() : max_leaf_size(4), worker_mgr(nullptr) {}
+
+void Bvh::allocBuffer(s32 max_primitives, Heap* heap)
+{
+    if (!tryAllocBuffer(max_primitives, heap))
+        AllocFailAssert(heap, calcBufferSize_(max_primitives), 64);
+}
+
+bool Bvh::tryAllocBuffer(s32 max_primitives, Heap* heap)
+{
+    SEAD_ASSERT(!isBufferReady());
+
+    if (!mNodes.tryAllocBuffer(calcNodeNumMax_(max_primitives), heap, 64) ||
+        !mIndices.tryAllocBuffer(max_primitives, heap) ||
+        !mSlots.tryAllocBuffer(max_primitives, heap) ||
+        !mBoxes.tryAllocBuffer(max_primitives, heap) ||
+        !mCenters.tryAllocBuffer(max_primitives, heap) ||
+        !mBuildQueue.tryInitialize(cParallelTaskMax, heap))
+    {
+        freeBuffer();
+        return false;
+    }
+
+    clear();
+    return true;
+}
+
+s32 Bvh::calcNodeNumMax_(s32 max_primitives)
+{
+    // The parallel build leaves gaps between the subtrees before compacting them.
+    return 2 * max_primitives + 2 * cParallelTaskMax;
+}
+
+size_t Bvh::calcBufferSize_(s32 max_primitives)
+{
+    return sizeof(Node) * calcNodeNumMax_(max_primitives) +
+           (2 * sizeof(s32) + sizeof(BoundBox3f) + sizeof(Vector3f)) * max_primitives +
+           sizeof(Job*) * cParallelTaskMax;
+}
+
+void Bvh::freeBuffer()
+{
+    if (mNodes.isBufferReady())
+        mBuildQueue.finalize();
+
+    mNodes.freeBuffer();
+    mIndices.freeBuffer();
+    mSlots.freeBuffer();
+    mBoxes.freeBuffer();
+    mCenters.freeBuffer();
+    clear();
+}
+
+void Bvh::clear()
+{
+    mNumPrimitives = 0;
+    mNumNodes = 0;
+}
+
+void Bvh::build(const BoundBox3f* boxes, s32 num, const BuildArg& arg)
+{
+    SEAD_ASSERT(isBufferReady());
+    if (num > mIndices.size())
+    {
+        SEAD_ASSERT_MSG(false, "too many primitives [%d > %d]", num, mIndices.size());
+        num = mIndices.size();
+    }
+
+    clear();
+    if (num <= 0)
+        return;
+
+    mBuildBoxes = boxes;
+    mMaxLeafSize = Mathi::max(arg.max_leaf_size, 1);
+    mNumPrimitives = num;
+    for (s32 i = 0; i < num; ++i)
+    {
+        mIndices(i) = i;
+        boxes[i].getCenter(&mCenters(i));
+    }
+
+    if (arg.worker_mgr && num >= cParallelTaskMinSize * 2)
+        buildParallel_(arg.worker_mgr, arg.core_mask);
+    else
+        mNumNodes = buildSubtree_(0, 0, num, 0, 1);
+
+    for (s32 i = 0; i < num; ++i)
+    {
+        mSlots(mIndices(i)) = i;
+        mBoxes(i) = boxes[mIndices(i)];
+    }
+    mBuildBoxes = nullptr;
+}
+
+void Bvh::setNodeBounds_(s32 node, s32 begin, s32 end)
+{
+    Node& n = mNodes(node);
+    n.min = mBuildBoxes[mIndices(begin)].getMin();
+    n.max = mBuildBoxes[mIndices(begin)].getMax();
+    for (s32 i = begin + 1; i < end; ++i)
+    {
+        const BoundBox3f& box = mBuildBoxes[mIndices(i)];
+        setUnion(&n.min, &n.max, box.getMin(), box.getMax());
+    }
+}
+
+bool Bvh::splitNode_(s32 node, s32 begin, s32 end, s32 depth, s32* mid)
+{
+    setNodeBounds_(node, begin, end);
+
+    Node& n = mNodes(node);
+    n.offset = begin;
+    n.count = end - begin;
+
+    const s32 num = end - begin;
+    if (num <= 1 || depth >= cDepthMax)
+        return false;
+
+    Vector3f center_min = mCenters(mIndices(begin));
+    Vector3f center_max = center_min;
+    for (s32 i = begin + 1; i < end; ++i)
+        setUnion(&center_min, &center_max, mCenters(mIndices(i)), mCenters(mIndices(i)));
+
+    // Bin the centers along every axis and evaluate the cost of a split between each pair of
+    // adjacent bins: the area of each side times the number of primitives on that side.
+    Bin bins[3][cBinNum];
+    f32 scales[3];
+    for (s32 axis = 0; axis < 3; ++axis)
+    {
+        const f32 extent = center_max.e[axis] - center_min.e[axis];
+        scales[axis] = extent > 0 ? cBinNum / extent : 0.0f;
+        for (s32 b = 0; b < cBinNum; ++b)
+        {
+            bins[axis][b].count = 0;
+            bins[axis][b].min.set(Mathf::maxNumber(), Mathf::maxNumber(), Mathf::maxNumber());
+            bins[axis][b].max.set(-Mathf::maxNumber(), -Mathf::maxNumber(), -Mathf::maxNumber());
+        }
+    }
+
+    for (s32 i = begin; i < end; ++i)
+    {
+        const s32 prim = mIndices(i);
+        const BoundBox3f& box = mBuildBoxes[prim];
+        for (s32 axis = 0; axis < 3; ++axis)
+        {
+            const f32 pos = (mCenters(prim).e[axis] - center_min.e[axis]) * scales[axis];
+            Bin& bin = bins[axis][Mathi::min(static_cast<s32>(pos), cBinNum - 1)];
+            ++bin.count;
+            setUnion(&bin.min, &bin.max, box.getMin(), box.getMax());
+        }
+    }
+
+    f32 best_cost = Mathf::maxNumber();
+    s32 best_axis = -1;
+    s32 best_split = 0;
+    for (s32 axis = 0; axis < 3; ++axis)
+    {
+        if (scales[axis] == 0)
+            continue;
+
+        // right_costs[b]: cost of the bins [b + 1, cBinNum) put together.
+        f32 right_costs[cBinNum];
+        Vector3f min = bins[axis][cBinNum - 1].min;
+        Vector3f max = bins[axis][cBinNum - 1].max;
+        s32 count = 0;
+        for (s32 b = cBinNum - 1; b > 0; --b)
+        {
+            const Bin& bin = bins[axis][b];
+            count += bin.count;
+            setUnion(&min, &max, bin.min, bin.max);
+            right_costs[b - 1] = count != 0 ? count * calcHalfArea(min, max) : 0.0f;
+        }
+
+        min = bins[axis][0].min;
+        max = bins[axis][0].max;
+        count = 0;
+        for (s32 b = 0; b < cBinNum - 1; ++b)
+        {
+            const Bin& bin = bins[axis][b];
+            count += bin.count;
+            setUnion(&min, &max, bin.min, bin.max);
+            if (count == 0 || count == num)
+                continue;
+
+            const f32 cost = count * calcHalfArea(min, max) + right_costs[b];
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_axis = axis;
+                best_split = b + 1;
+            }
+        }
+    }
+
+    if (best_axis < 0)
+    {
+        // All centers are at the same position. Split in the middle to bound the leaf size.
+        if (num <= mMaxLeafSize)
+            return false;
+        *mid = begin + num / 2;
+        n.offset = 0;
+        n.count = 0;
+        return true;
+    }
+
+    // Traversing a node costs about as much as testing one primitive.
+    const f32 node_area = calcHalfArea(n.min, n.max);
+    if (num <= mMaxLeafSize && num * node_area <= node_area + best_cost)
+        return false;
+
+    s32 i = begin;
+    s32 j = end - 1;
+    const f32 offset = center_min.e[best_axis];
+    const f32 scale = scales[best_axis];
+    while (i <= j)
+    {
+        const f32 pos = (mCenters(mIndices(i)).e[best_axis] - offset) * scale;
+        if (Mathi::min(static_cast<s32>(pos), cBinNum - 1) < best_split)
+        {
+            ++i;
+        }
+        else
+        {
+            const s32 tmp = mIndices(i);
+            mIndices(i) = mIndices(j);
+            mIndices(j) = tmp;
+            --j;
+        }
+    }
+
+    *mid = i;
+    n.offset = 0;
+    n.count = 0;
+    return true;
+}
+
+s32 Bvh::buildSubtree_(s32 root, s32 begin, s32 end, s32 depth, s32 node_begin)
+{
+    struct Task
+    {
+        s32 node;
+        s32 begin;
+        s32 end;
+        s32 depth;
+    };
+
+    // Building the first child before its sibling keeps every subtree contiguous.
+    Task stack[cStackSize];
+    s32 sp = 0;
+    stack[sp++] = {root, begin, end, depth};
+    s32 next = node_begin;
+    while (sp > 0)
+    {
+        const Task task = stack[--sp];
+        s32 mid;
+        if (!splitNode_(task.node, task.begin, task.end, task.depth, &mid))
+            continue;
+
+        const s32 child = next;
+        next += 2;
+        mNodes(task.node).offset = child;
+        stack[sp++] = {child + 1, mid, task.end, task.depth + 1};
+        stack[sp++] = {child, task.begin, mid, task.depth + 1};
+    }
+
+    return next;
+}
+
+void Bvh::BuildJob::invoke()
+{
+    node_end = bvh->buildSubtree_(root, begin, end, depth, node_begin);
+}
+
+void Bvh::buildParallel_(WorkerMgr* worker_mgr, CoreIdMask core_mask)
+{
+    // Split the upper levels on this thread, always splitting the largest pending range, until
+    // there are enough ranges to keep the workers busy.
+    s32 num_jobs = 1;
+    mBuildJobs[0].root = 0;
+    mBuildJobs[0].begin = 0;
+    mBuildJobs[0].end = mNumPrimitives;
+    mBuildJobs[0].depth = 0;
+    mNumNodes = 1;
+
+    while (num_jobs < cParallelTaskMax)
+    {
+        s32 largest = 0;
+        for (s32 i = 1; i < num_jobs; ++i)
+        {
+            if (mBuildJobs[i].end - mBuildJobs[i].begin >
+                mBuildJobs[largest].end - mBuildJobs[largest].begin)
+            {
+                largest = i;
+            }
+        }
+
+        BuildJob& job = mBuildJobs[largest];
+        if (job.end - job.begin < cParallelTaskMinSize * 2)
+            break;
+
+        s32 mid;
+        if (!splitNode_(job.root, job.begin, job.end, job.depth, &mid))
+            break;
+
+        const s32 child = mNumNodes;
+        mNumNodes += 2;
+        mNodes(job.root).offset = child;
+
+        BuildJob& right = mBuildJobs[num_jobs++];
+        right.root = child + 1;
+        right.begin = mid;
+        right.end = job.end;
+        right.depth = job.depth + 1;
+        job.root = child;
+        job.end = mid;
+        job.depth = job.depth + 1;
+    }
+
+    // A subtree over n primitives has at most 2n - 2 nodes below its root.
+    s32 node_begin = 2 * cParallelTaskMax;
+    mBuildQueue.clear();
+    for (s32 i = 0; i < num_jobs; ++i)
+    {
+        BuildJob& job = mBuildJobs[i];
+        job.bvh = this;
+        job.node_begin = node_begin;
+        job.node_end = node_begin;
+        node_begin += 2 * (job.end - job.begin) - 2;
+        mBuildQueue.enque(&job);
+    }
+
+    worker_mgr->pushJobQueue("sead::Bvh::build", &mBuildQueue, core_mask, SyncType::cCore,
+                             JobQueuePushType::cForward);
+    worker_mgr->run();
+    worker_mgr->sync();
+
+    // Close the gaps between the subtrees. Ranges only move down, so that a child index is
+    // still larger than the index of its parent, which refit relies on.
+    for (s32 i = 0; i < num_jobs; ++i)
+    {
+        const BuildJob& job = mBuildJobs[i];
+        const s32 delta = mNumNodes - job.node_begin;
+        for (s32 j = job.node_begin; j < job.node_end; ++j)
+        {
+            Node& node = mNodes(j + delta);
+            node = mNodes(j);
+            if (!node.isLeaf())
+                node.offset += delta;
+        }
+
+        if (!mNodes(job.root).isLeaf())
+            mNodes(job.root).offset += delta;
+        mNumNodes += job.node_end - job.node_begin;
+    }
+}
+
+void Bvh::refit()
+{
+    for (s32 i = mNumNodes - 1; i >= 0; --i)
+    {
+        Node& node = mNodes(i);
+        if (node.isLeaf())
+        {
+            node.min = mBoxes(node.offset).getMin();
+            node.max = mBoxes(node.offset).getMax();
+            for (s32 j = node.offset + 1; j < node.offset + node.count; ++j)
+                setUnion(&node.min, &node.max, mBoxes(j).getMin(), mBoxes(j).getMax());
+        }
+        else
+        {
+            const Node& a = mNodes(node.offset);
+            const Node& b = mNodes(node.offset + 1);
+            node.min = a.min;
+            node.max = a.max;
+            setUnion(&node.min, &node.max, b.min, b.max);
+        }
+    }
+}
+
+void Bvh::refit(const BoundBox3f* boxes)
+{
+    for (s32 i = 0; i < mNumPrimitives; ++i)
+        mBoxes(i) = boxes[mIndices(i)];
+    refit();
+}
+
+s32 Bvh::queryBox(s32* out, s32 out_max, const BoundBox3f& box) const
+{
+    if (mNumNodes == 0)
+        return 0;
+
+    s32 num = 0;
+    s32 stack[cStackSize];
+    s32 sp = 0;
+    stack[sp++] = 0;
+    while (sp > 0)
+    {
+        const Node& node = mNodes(stack[--sp]);
+        if (!isOverlap(node.min, node.max, box))
+            continue;
+
+        if (!node.isLeaf())
+        {
+            stack[sp++] = node.offset + 1;
+            stack[sp++] = node.offset;
+            continue;
+        }
+
+        for (s32 i = node.offset; i < node.offset + node.count; ++i)
+        {
+            if (!isOverlap(mBoxes(i).getMin(), mBoxes(i).getMax(), box))
+                continue;
+            if (num < out_max)
+                out[num] = mIndices(i);
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+s32 Bvh::queryFrustum(s32* out, s32 out_max, const Frustum& frustum) const
+{
+    if (mNumNodes == 0)
+        return 0;
+
+    s32 num = 0;
+    s32 stack[cStackSize];
+    s32 sp = 0;
+    stack[sp++] = 0;
+    while (sp > 0)
+    {
+        const Node& node = mNodes(stack[--sp]);
+        if (!frustum.isIntersectBox(BoundBox3f(node.min, node.max)))
+            continue;
+
+        if (!node.isLeaf())
+        {
+            stack[sp++] = node.offset + 1;
+            stack[sp++] = node.offset;
+            continue;
+        }
+
+        for (s32 i = node.offset; i < node.offset + node.count; ++i)
+        {
+            if (!frustum.isIntersectBox(mBoxes(i)))
+                continue;
+            if (num < out_max)
+                out[num] = mIndices(i);
+            ++num;
+        }
+    }
+
+    return num;
+}
+
+s32 Bvh::queryRay(s32* out, s32 out_max, const Ray<Vector3f>& ray, f32 max_dist) const
+{
+    if (mNumNodes == 0)
+        return 0;
+
+    const RaySlab slab(ray, max_dist);
+    if (slab.test(mNodes(0).min, mNodes(0).max) < 0)
+        return 0;
+
+    s32 num = 0;
+    s32 stack[cStackSize];
+    s32 sp = 0;
+    stack[sp++] = 0;
+    while (sp > 0)
+    {
+        const Node& node = mNodes(stack[--sp]);
+        if (node.isLeaf())
+        {
+            for (s32 i = node.offset; i < node.offset + node.count; ++i)
+            {
+                if (slab.test(mBoxes(i).getMin(), mBoxes(i).getMax()) < 0)
+                    continue;
+                if (num < out_max)
+                    out[num] = mIndices(i);
+                ++num;
+            }
+            continue;
+        }
+
+        // Visit the nearer child first.
+        const s32 a = node.offset;
+        const s32 b = node.offset + 1;
+        const f32 t_a = slab.test(mNodes(a).min, mNodes(a).max);
+        const f32 t_b = slab.test(mNodes(b).min, mNodes(b).max);
+        if (t_a >= 0 && t_b >= 0)
+        {
+            stack[sp++] = t_a <= t_b ? b : a;
+            stack[sp++] = t_a <= t_b ? a : b;
+        }
+        else if (t_a >= 0)
+        {
+            stack[sp++] = a;
+        }
+        else if (t_b >= 0)
+        {
+            stack[sp++] = b;
+        }
+    }
+
+    return num;
+}
+
+s32 Bvh::raycast(f32* t, const Ray<Vector3f>& ray, f32 max_dist) const
+{
+    if (mNumNodes == 0)
+        return -1;
+
+    RaySlab slab(ray, max_dist);
+    f32 best_t = max_dist;
+    s32 best = -1;
+
+    struct Entry
+    {
+        s32 node;
+        f32 t;
+    };
+    Entry stack[cStackSize];
+    s32 sp = 0;
+    const f32 root_t = slab.test(mNodes(0).min, mNodes(0).max);
+    if (root_t >= 0)
+        stack[sp++] = {0, root_t};
+
+    while (sp > 0)
+    {
+        const Entry entry = stack[--sp];
+        // A closer hit has been found since this node was pushed.
+        if (entry.t > best_t)
+            continue;
+
+        const Node& node = mNodes(entry.node);
+        if (node.isLeaf())
+        {
+            for (s32 i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const f32 hit = slab.test(mBoxes(i).getMin(), mBoxes(i).getMax());
+                if (hit >= 0 && (best < 0 || hit < best_t))
+                {
+                    best_t = hit;
+                    best = mIndices(i);
+                    slab.setMaxDist(best_t);
+                }
+            }
+            continue;
+        }
+
+        const s32 a = node.offset;
+        const s32 b = node.offset + 1;
+        const f32 t_a = slab.test(mNodes(a).min, mNodes(a).max);
+        const f32 t_b = slab.test(mNodes(b).min, mNodes(b).max);
+        // Push the farther child first so that the nearer one is visited next.
+        if (t_a >= 0 && t_b >= 0)
+        {
+            if (t_a <= t_b)
+            {
+                stack[sp++] = {b, t_b};
+                stack[sp++] = {a, t_a};
+            }
+            else
+            {
+                stack[sp++] = {a, t_a};
+                stack[sp++] = {b, t_b};
+            }
+        }
+        else if (t_a >= 0)
+        {
+            stack[sp++] = {a, t_a};
+        }
+        else if (t_b >= 0)
+        {
+            stack[sp++] = {b, t_b};
+        }
+    }
+
+    if (best >= 0 && t)
+        *t = best_t;
+    return best;
+}
+
+s32 Bvh::findNearest(f32* dist_sq, const Vector3f& p, f32 max_dist_sq) const
+{
+    if (mNumNodes == 0)
+        return -1;
+
+    f32 best_dist = max_dist_sq;
+    s32 best = -1;
+
+    struct Entry
+    {
+        s32 node;
+        f32 dist;
+    };
+    Entry stack[cStackSize];
+    s32 sp = 0;
+    stack[sp++] = {0, calcSquaredDistance(mNodes(0).min, mNodes(0).max, p)};
+
+    while (sp > 0)
+    {
+        const Entry entry = stack[--sp];
+        if (entry.dist > best_dist)
+            continue;
+
+        const Node& node = mNodes(entry.node);
+        if (node.isLeaf())
+        {
+            for (s32 i = node.offset; i < node.offset + node.count; ++i)
+            {
+                const f32 dist = calcSquaredDistance(mBoxes(i).getMin(), mBoxes(i).getMax(), p);
+                if (dist <= best_dist && (best < 0 || dist < best_dist))
+                {
+                    best_dist = dist;
+                    best = mIndices(i);
+                }
+            }
+            continue;
+        }
+
+        const s32 a = node.offset;
+        const s32 b = node.offset + 1;
+        const f32 d_a = calcSquaredDistance(mNodes(a).min, mNodes(a).max, p);
+        const f32 d_b = calcSquaredDistance(mNodes(b).min, mNodes(b).max, p);
+        if (d_a <= d_b)
+        {
+            stack[sp++] = {b, d_b};
+            stack[sp++] = {a, d_a};
+        }
+        else
+        {
+            stack[sp++] = {a, d_a};
+            stack[sp++] = {b, d_b};
+        }
+    }
+
+    if (best >= 0 && dist_sq)
+        *dist_sq = best_dist;
+    return best;
+}
+
+}  // namespace sead
@@ -0,0 +1,156 @@
+#include "math/seadCompressedQuat.h"
+#include "math/seadMathCalcCommon.h"
+#include "prim/seadBitUtil.h"
+
+namespace sead
+{
+namespace
+{
+constexpr f32 cInvSqrt2 = 0.70710678118654752f;
+
+/// Number of quantization steps: the largest quantized value. Even, so that 0 is exact.
+template <s32 Bits>
+constexpr u32 cQuantMax = (1u << Bits) - 2;
+
+template <s32 Bits>
+u32 quantize(f32 v)
+{
+    constexpr f32 scale = cQuantMax<Bits> * cInvSqrt2;
+    const f32 f = v * scale + cQuantMax<Bits> * 0.5f + 0.5f;
+    // The components are at most 1/sqrt(2) in magnitude, but rounding errors in the input can
+    // push them slightly out of range.
+    if (!(f > 0))
+        return 0;
+    return Mathu::min(static_cast<u32>(f), cQuantMax<Bits>);
+}
+
+template <s32 Bits>
+f32 dequantize(u32 v)
+{
+    return static_cast<f32>(v) * (2 * cInvSqrt2 / cQuantMax<Bits>) - cInvSqrt2;
+}
+
+/// Returns cond ? a : b without a branch.
+f32 select(bool cond, f32 a, f32 b)
+{
+    const u32 mask = 0u - static_cast<u32>(cond);
+    return BitUtil::bitCast<f32>((BitUtil::bitCast<u32>(a) & mask) |
+                                 (BitUtil::bitCast<u32>(b) & ~mask));
+}
+
+/// Returns (index of the dropped component << (3 * Bits)) | the three quantized components.
+template <s32 Bits>
+u64 encodeImpl(const Quatf& q)
+{
+    const f32 c[4] = {q.x, q.y, q.z, q.w};
+
+    s32 largest = 0;
+    f32 largest_abs = Mathf::abs(c[0]);
+    for (s32 i = 1; i < 4; ++i)
+    {
+        const f32 a = Mathf::abs(c[i]);
+        if (a > largest_abs)
+        {
+            largest = i;
+            largest_abs = a;
+        }
+    }
+    const f32 sign = c[largest] < 0 ? -1.0f : 1.0f;
+
+    u64 bits = static_cast<u64>(largest);
+    for (s32 i = 0; i < 4; ++i)
+    {
+        if (i != largest)
+            bits = (bits << Bits) | quantize<Bits>(c[i] * sign);
+    }
+    return bits;
+}
+
+template <s32 Bits>
+void decodeImpl(Quatf* q, u32 largest, u32 qa, u32 qb, u32 qc)
+{
+    const f32 a = dequantize<Bits>(qa);
+    const f32 b = dequantize<Bits>(qb);
+    const f32 c = dequantize<Bits>(qc);
+    const f32 d = MathCalcCommon<f32>::sqrt(Mathf::max(1 - a * a - b * b - c * c, 0.0f));
+
+    // Bitwise selects rather than an indexed store or branches, which keeps the batched loops
+    // vectorizable.
+    const f32 x = select(largest == 0, d, a);
+    const f32 y = select(largest == 1, d, select(largest < 1, a, b));
+    const f32 z = select(largest == 2, d, select(largest < 2, b, c));
+    const f32 w = select(largest == 3, d, c);
+    q->x = x;
+    q->y = y;
+    q->z = z;
+    q->w = w;
+}
+
+// The fields are extracted with 32-bit operations only: 64-bit lanes would halve the vector
+// width, and most targets cannot convert them to f32 without leaving the vector unit.
+
+void decode48(Quatf* q, const CompressedQuat48& in)
+{
+    const u32 w0 = in.data[0];
+    const u32 w1 = in.data[1];
+    const u32 w2 = in.data[2];
+    const u32 a = ((w0 & 0x1fff) << 2) | (w1 >> 14);
+    const u32 b = ((w1 & 0x3fff) << 1) | (w2 >> 15);
+    decodeImpl<15>(q, w0 >> 13, a, b, w2 & 0x7fff);
+}
+
+void decode32(Quatf* q, const CompressedQuat32& in)
+{
+    const u32 bits = in.data;
+    decodeImpl<10>(q, bits >> 30, (bits >> 20) & 0x3ff, (bits >> 10) & 0x3ff, bits & 0x3ff);
+}
+}  // namespace
+
+void CompressedQuat48::encode(const Quatf& q)
+{
+    const u64 bits = encodeImpl<15>(q);
+    data[0] = static_cast<u16>(bits >> 32);
+    data[1] = static_cast<u16>(bits >> 16);
+    data[2] = static_cast<u16>(bits);
+}
+
+void CompressedQuat48::decode(Quatf* q) const
+{
+    decode48(q, *this);
+}
+
+void CompressedQuat48::encode(CompressedQuat48* out, const Quatf* q, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i].encode(q[i]);
+}
+
+void CompressedQuat48::decode(Quatf* out, const CompressedQuat48* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        decode48(&out[i], in[i]);
+}
+
+void CompressedQuat32::encode(const Quatf& q)
+{
+    data = static_cast<u32>(encodeImpl<10>(q));
+}
+
+void CompressedQuat32::decode(Quatf* q) const
+{
+    decode32(q, *this);
+}
+
+void CompressedQuat32::encode(CompressedQuat32* out, const Quatf* q, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i].encode(q[i]);
+}
+
+void CompressedQuat32::decode(Quatf* out, const CompressedQuat32* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        decode32(&out[i], in[i]);
+}
+
+}  // namespace sead
@@ -0,0 +1,7 @@
+#include <math/seadDualQuat.h>
+
+namespace sead
+{
+template <>
+const DualQuatf DualQuatf::unit(Quatf(1.0f, 0.0f, 0.0f, 0.0f), Quatf(0.0f, 0.0f, 0.0f, 0.0f));
+}  // namespace sead
@@ -0,0 +1,279 @@
+#include <algorithm>
+#include "math/seadHashGrid.h"
+#include "basis/seadNew.h"
+#include "basis/seadRawPrint.h"
+#include "math/seadMathCalcCommon.h"
+#include "mc/seadWorkerMgr.h"
+
+namespace sead
+{
+namespace
+{
+struct RadiusTest
+{
+    bool operator()(const Vector3f& p) const
+    {
+        const f32 dx = p.x - center.x;
+        const f32 dy = p.y - center.y;
+        const f32 dz = p.z - center.z;
+        return dx * dx + dy * dy + dz * dz <= radius_sq;
+    }
+
+    Vector3f center;
+    f32 radius_sq;
+};
+
+struct BoxTest
+{
+    bool operator()(const Vector3f& p) const
+    {
+        return min.x <= p.x && p.x <= max.x && min.y <= p.y && p.y <= max.y && min.z <= p.z &&
+               p.z <= max.z;
+    }
+
+    Vector3f min;
+    Vector3f max;
+};
+
+/// Converts a coordinate in cell units to a cell coordinate. It is clamped to +-2^30 first, so
+/// that the conversion is defined for far away, infinite or NaN positions and iterating over
+/// cells cannot overflow. Points and queries are clamped alike, so every point is still found.
+s32 calcCellCoord(f32 x)
+{
+    constexpr f32 cLimit = 1 << 30;
+    return Mathf::floor(x > -cLimit ? (x < cLimit ? x : cLimit) : -cLimit);
+}
+}  // namespace
+
+HashGrid::BuildArg::BuildArg() : worker_mgr(nullptr) {}
+
+void HashGrid::allocBuffer(s32 max_points, Heap* heap, s32 bucket_num)
+{
+    if (!tryAllocBuffer(max_points, heap, bucket_num))
+        AllocFailAssert(heap, calcBufferSize_(max_points, bucket_num), sizeof(void*));
+}
+
+bool HashGrid::tryAllocBuffer(s32 max_points, Heap* heap, s32 bucket_num)
+{
+    SEAD_ASSERT(!isBufferReady());
+
+    const s32 num = calcBucketNum_(max_points, bucket_num);
+    if (!mBucketStarts.tryAllocBuffer(num + 1, heap) ||
+        !mIndices.tryAllocBuffer(max_points, heap) ||
+        !mPositions.tryAllocBuffer(max_points, heap) ||
+        !mCells.tryAllocBuffer(max_points, heap) ||
+        !mPointCells.tryAllocBuffer(max_points, heap) ||
+        !mPointBuckets.tryAllocBuffer(max_points, heap) ||
+        !mBuildQueue.tryInitialize(cParallelTaskMax, heap))
+    {
+        freeBuffer();
+        return false;
+    }
+
+    mBucketMask = num - 1;
+    clear();
+    return true;
+}
+
+s32 HashGrid::calcBucketNum_(s32 max_points, s32 bucket_num)
+{
+    if (bucket_num <= 0)
+        bucket_num = max_points * 2;
+    s32 num = 1;
+    while (num < bucket_num)
+        num <<= 1;
+    return num;
+}
+
+size_t HashGrid::calcBufferSize_(s32 max_points, s32 bucket_num)
+{
+    return sizeof(s32) * (calcBucketNum_(max_points, bucket_num) + 1) +
+           (2 * sizeof(s32) + sizeof(Vector3f) + 2 * sizeof(Vector3i)) * max_points +
+           sizeof(Job*) * cParallelTaskMax;
+}
+
+void HashGrid::freeBuffer()
+{
+    if (mBucketStarts.isBufferReady())
+        mBuildQueue.finalize();
+
+    mBucketStarts.freeBuffer();
+    mIndices.freeBuffer();
+    mPositions.freeBuffer();
+    mCells.freeBuffer();
+    mPointCells.freeBuffer();
+    mPointBuckets.freeBuffer();
+    mBucketMask = 0;
+    mNumPoints = 0;
+}
+
+void HashGrid::clear()
+{
+    mNumPoints = 0;
+    for (s32 i = 0; i < mBucketStarts.size(); ++i)
+        mBucketStarts(i) = 0;
+}
+
+void HashGrid::calcCell(Vector3i* cell, const Vector3f& pos) const
+{
+    cell->set(calcCellCoord(pos.x * mInvCellSize), calcCellCoord(pos.y * mInvCellSize),
+              calcCellCoord(pos.z * mInvCellSize));
+}
+
+void HashGrid::build(const Vector3f* positions, s32 num, f32 cell_size, const BuildArg& arg)
+{
+    SEAD_ASSERT(isBufferReady());
+    SEAD_ASSERT_MSG(cell_size > 0, "cell_size[%f] must be positive", cell_size);
+    if (num > mIndices.size())
+    {
+        SEAD_ASSERT_MSG(false, "too many points [%d > %d]", num, mIndices.size());
+        num = mIndices.size();
+    }
+
+    clear();
+    mCellSize = cell_size;
+    mInvCellSize = 1.0f / cell_size;
+    if (num <= 0)
+        return;
+    mNumPoints = num;
+
+    if (arg.worker_mgr && num >= cParallelTaskMinSize * 2)
+    {
+        const s32 num_jobs = Mathi::min(num / cParallelTaskMinSize, cParallelTaskMax);
+        mBuildQueue.clear();
+        for (s32 i = 0; i < num_jobs; ++i)
+        {
+            BuildJob& job = mBuildJobs[i];
+            job.grid = this;
+            job.positions = positions;
+            job.begin = static_cast<s32>(static_cast<s64>(num) * i / num_jobs);
+            job.end = static_cast<s32>(static_cast<s64>(num) * (i + 1) / num_jobs);
+            mBuildQueue.enque(&job);
+        }
+
+        arg.worker_mgr->pushJobQueue("sead::HashGrid::build", &mBuildQueue, arg.core_mask,
+                                     SyncType::cCore, JobQueuePushType::cForward);
+        arg.worker_mgr->run();
+        arg.worker_mgr->sync();
+    }
+    else
+    {
+        calcCells_(positions, 0, num);
+    }
+
+    // Counting sort: count the points of every bucket, turn the counts into end offsets, then
+    // fill every bucket from its end. Filling backwards keeps the points of a bucket in the
+    // order of their indices.
+    const s32 bucket_num = mBucketStarts.size() - 1;
+    for (s32 i = 0; i < num; ++i)
+        ++mBucketStarts(mPointBuckets(i));
+
+    s32 sum = 0;
+    for (s32 b = 0; b < bucket_num; ++b)
+    {
+        sum += mBucketStarts(b);
+        mBucketStarts(b) = sum;
+    }
+    mBucketStarts(bucket_num) = sum;
+
+    for (s32 i = num - 1; i >= 0; --i)
+    {
+        const s32 slot = --mBucketStarts(mPointBuckets(i));
+        mIndices(slot) = i;
+        mPositions(slot) = positions[i];
+        mCells(slot) = mPointCells(i);
+    }
+}
+
+void HashGrid::BuildJob::invoke()
+{
+    grid->calcCells_(positions, begin, end);
+}
+
+void HashGrid::calcCells_(const Vector3f* positions, s32 begin, s32 end)
+{
+    for (s32 i = begin; i < end; ++i)
+    {
+        Vector3i& cell = mPointCells(i);
+        calcCell(&cell, positions[i]);
+        mPointBuckets(i) = static_cast<s32>(calcHash_(cell) & mBucketMask);
+    }
+}
+
+template <typename Test>
+s32 HashGrid::query_(s32* out, s32 out_max, const Vector3i& min, const Vector3i& max,
+                     const Test& test) const
+{
+    s32 num = 0;
+    if (min.x > max.x || min.y > max.y || min.z > max.z)
+        return num;
+
+    // Count the cells up to mNumPoints only: the count of a huge box would overflow.
+    const s64 extents[3] = {s64(max.x) - min.x + 1, s64(max.y) - min.y + 1,
+                            s64(max.z) - min.z + 1};
+    s64 num_cells = 1;
+    for (s64 extent : extents)
+        num_cells = std::min<s64>(num_cells * extent, mNumPoints);
+    if (num_cells >= mNumPoints)
+    {
+        // Visiting the cells would cost more than testing every point.
+        for (s32 i = 0; i < mNumPoints; ++i)
+        {
+            if (!test(mPositions(i)))
+                continue;
+            if (num < out_max)
+                out[num] = mIndices(i);
+            ++num;
+        }
+        return num;
+    }
+
+    Vector3i cell;
+    for (cell.z = min.z; cell.z <= max.z; ++cell.z)
+    {
+        for (cell.y = min.y; cell.y <= max.y; ++cell.y)
+        {
+            for (cell.x = min.x; cell.x <= max.x; ++cell.x)
+            {
+                const s32 bucket = static_cast<s32>(calcHash_(cell) & mBucketMask);
+                const s32 end = mBucketStarts(bucket + 1);
+                for (s32 i = mBucketStarts(bucket); i < end; ++i)
+                {
+                    // Other cells can share the bucket; they are visited on their own.
+                    const Vector3i& c = mCells(i);
+                    if (c.x != cell.x || c.y != cell.y || c.z != cell.z || !test(mPositions(i)))
+                        continue;
+                    if (num < out_max)
+                        out[num] = mIndices(i);
+                    ++num;
+                }
+            }
+        }
+    }
+
+    return num;
+}
+
+s32 HashGrid::queryRadius(s32* out, s32 out_max, const Vector3f& center, f32 radius) const
+{
+    if (mNumPoints == 0 || radius < 0)
+        return 0;
+
+    Vector3i min, max;
+    calcCell(&min, center - Vector3f(radius, radius, radius));
+    calcCell(&max, center + Vector3f(radius, radius, radius));
+    return query_(out, out_max, min, max, RadiusTest{center, radius * radius});
+}
+
+s32 HashGrid::queryBox(s32* out, s32 out_max, const BoundBox3f& box) const
+{
+    if (mNumPoints == 0)
+        return 0;
+
+    Vector3i min, max;
+    calcCell(&min, box.getMin());
+    calcCell(&max, box.getMax());
+    return query_(out, out_max, min, max, BoxTest{box.getMin(), box.getMax()});
+}
+
+}  // namespace sead
@@ -0,0 +1,120 @@
+#include "math/seadMathFastCalc.h"
+
+namespace sead
+{
+namespace
+{
+// The loops are kept free of calls and branches so that they can be vectorized.
+
+template <MathFastCalc::Precision P>
+void calcSinCos(f32* out_sin, f32* out_cos, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+    {
+        f32 s, c;
+        MathFastCalc::fastSinCos<P>(x[i], &s, &c);
+        out_sin[i] = s;
+        out_cos[i] = c;
+    }
+}
+
+template <MathFastCalc::Precision P>
+void calcSin(f32* out, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastSin<P>(x[i]);
+}
+
+template <MathFastCalc::Precision P>
+void calcCos(f32* out, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastCos<P>(x[i]);
+}
+
+template <MathFastCalc::Precision P>
+void calcAtan2(f32* out, const f32* y, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastAtan2<P>(y[i], x[i]);
+}
+
+template <MathFastCalc::Precision P>
+void calcExp(f32* out, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastExp<P>(x[i]);
+}
+
+template <MathFastCalc::Precision P>
+void calcLog(f32* out, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastLog<P>(x[i]);
+}
+
+template <MathFastCalc::Precision P>
+void calcRsqrt(f32* out, const f32* x, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = MathFastCalc::fastRsqrt<P>(x[i]);
+}
+}  // namespace
+
+void MathFastCalc::fastSin(f32* out, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcSin<cPrecision_Low>(out, x, n);
+    else
+        calcSin<cPrecision_High>(out, x, n);
+}
+
+void MathFastCalc::fastCos(f32* out, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcCos<cPrecision_Low>(out, x, n);
+    else
+        calcCos<cPrecision_High>(out, x, n);
+}
+
+void MathFastCalc::fastSinCos(f32* out_sin, f32* out_cos, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcSinCos<cPrecision_Low>(out_sin, out_cos, x, n);
+    else
+        calcSinCos<cPrecision_High>(out_sin, out_cos, x, n);
+}
+
+void MathFastCalc::fastAtan2(f32* out, const f32* y, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcAtan2<cPrecision_Low>(out, y, x, n);
+    else
+        calcAtan2<cPrecision_High>(out, y, x, n);
+}
+
+void MathFastCalc::fastExp(f32* out, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcExp<cPrecision_Low>(out, x, n);
+    else
+        calcExp<cPrecision_High>(out, x, n);
+}
+
+void MathFastCalc::fastLog(f32* out, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcLog<cPrecision_Low>(out, x, n);
+    else
+        calcLog<cPrecision_High>(out, x, n);
+}
+
+void MathFastCalc::fastRsqrt(f32* out, const f32* x, s32 n, Precision p)
+{
+    if (p == cPrecision_Low)
+        calcRsqrt<cPrecision_Low>(out, x, n);
+    else
+        calcRsqrt<cPrecision_High>(out, x, n);
+}
+
+}  // namespace sead
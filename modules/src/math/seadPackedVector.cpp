@@ -0,0 +1,177 @@
+#include "math/seadPackedVector.h"
+#include "math/seadMathCalcCommon.h"
+#include "prim/seadBitUtil.h"
+
+#if defined(SEAD_MATH_SIMD_NEON)
+#include <arm_neon.h>
+#elif defined(SEAD_MATH_SIMD_SSE) && defined(__F16C__)
+#include <immintrin.h>
+#define SEAD_PACKED_VECTOR_F16C
+#endif
+
+namespace sead
+{
+namespace
+{
+// Bit manipulation conversions, used where there is no conversion instruction. Both are free of
+// branches so that the batch loops can be vectorized.
+
+u16 f32ToF16(f32 v)
+{
+    const u32 f_signed = BitUtil::bitCast<u32>(v);
+    const u32 sign = (f_signed >> 16) & 0x8000;
+    const u32 f = f_signed & 0x7fffffff;
+
+    // Inf or NaN (quiet NaN with the top mantissa bit set), and overflows to inf.
+    const u32 special = f > 0x7f800000 ? 0x7e00u : 0x7c00u;
+
+    // Results below the smallest normal (2^-14): adding 0.5 aligns the mantissa so that the FPU
+    // rounds it to nearest even at the position of the f16 subnormal mantissa.
+    const f32 denorm_magic = 0.5f;
+    const u32 denorm =
+        BitUtil::bitCast<u32>(BitUtil::bitCast<f32>(f) + denorm_magic) - 0x3f000000u;
+
+    // Normals: rebias the exponent, then round to nearest even on the 13 dropped bits.
+    const u32 mant_odd = (f >> 13) & 1;
+    const u32 normal = (f + 0xc8000fffu + mant_odd) >> 13;
+
+    const u32 h = f >= 0x47800000 ? special : (f < 0x38800000 ? denorm : normal);
+    return static_cast<u16>(h | sign);
+}
+
+f32 f16ToF32(u16 h)
+{
+    constexpr u32 shifted_exp = 0x7c00u << 13;
+    const u32 bits = (h & 0x7fffu) << 13;
+    const u32 exp = bits & shifted_exp;
+    const u32 rebiased = bits + ((127 - 15) << 23);
+
+    // Inf or NaN: move to the maximum f32 exponent.
+    const u32 special = rebiased + ((128 - 16) << 23);
+    // Zero or subnormal: let the FPU renormalize.
+    const u32 denorm = BitUtil::bitCast<u32>(BitUtil::bitCast<f32>(rebiased + (1 << 23)) -
+                                             BitUtil::bitCast<f32>(113u << 23));
+
+    const u32 f = exp == shifted_exp ? special : (exp == 0 ? denorm : rebiased);
+    return BitUtil::bitCast<f32>(f | ((h & 0x8000u) << 16));
+}
+
+// The normalized conversions shift the values to be positive so that truncation rounds to
+// nearest; f32 to integer conversions truncate towards zero.
+
+s16 f32ToSnorm16(f32 v)
+{
+    const f32 clamped = Mathf::clamp(v, -1.0f, 1.0f);
+    const s32 shifted = static_cast<s32>(clamped * Snorm16::cMax + (Snorm16::cMax + 1.5f));
+    return static_cast<s16>(shifted - (Snorm16::cMax + 1));
+}
+
+f32 snorm16ToF32(s16 v)
+{
+    return Mathf::max(static_cast<f32>(v) * (1.0f / Snorm16::cMax), -1.0f);
+}
+
+u8 f32ToUnorm8(f32 v)
+{
+    const f32 clamped = Mathf::clamp(v, 0.0f, 1.0f);
+    return static_cast<u8>(static_cast<s32>(clamped * Unorm8::cMax + 0.5f));
+}
+
+f32 unorm8ToF32(u8 v)
+{
+    return static_cast<f32>(v) * (1.0f / Unorm8::cMax);
+}
+}  // namespace
+
+Float16 Float16::fromF32(f32 v)
+{
+    return {f32ToF16(v)};
+}
+
+f32 Float16::toF32() const
+{
+    return f16ToF32(bits);
+}
+
+Snorm16 Snorm16::fromF32(f32 v)
+{
+    return {f32ToSnorm16(v)};
+}
+
+f32 Snorm16::toF32() const
+{
+    return snorm16ToF32(value);
+}
+
+Unorm8 Unorm8::fromF32(f32 v)
+{
+    return {f32ToUnorm8(v)};
+}
+
+f32 Unorm8::toF32() const
+{
+    return unorm8ToF32(value);
+}
+
+void PackedVectorUtil::pack(Float16* out, const f32* in, s32 n)
+{
+    s32 i = 0;
+#if defined(SEAD_MATH_SIMD_NEON)
+    for (; i + 4 <= n; i += 4)
+    {
+        const float16x4_t h = vcvt_f16_f32(vld1q_f32(in + i));
+        vst1_u16(&out[i].bits, vreinterpret_u16_f16(h));
+    }
+#elif defined(SEAD_PACKED_VECTOR_F16C)
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i h = _mm_cvtps_ph(_mm_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(&out[i].bits), h);
+    }
+#endif
+    for (; i < n; ++i)
+        out[i].bits = f32ToF16(in[i]);
+}
+
+void PackedVectorUtil::unpack(f32* out, const Float16* in, s32 n)
+{
+    s32 i = 0;
+#if defined(SEAD_MATH_SIMD_NEON)
+    for (; i + 4 <= n; i += 4)
+        vst1q_f32(out + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&in[i].bits))));
+#elif defined(SEAD_PACKED_VECTOR_F16C)
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m128i h = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&in[i].bits));
+        _mm_storeu_ps(out + i, _mm_cvtph_ps(h));
+    }
+#endif
+    for (; i < n; ++i)
+        out[i] = f16ToF32(in[i].bits);
+}
+
+void PackedVectorUtil::pack(Snorm16* out, const f32* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i].value = f32ToSnorm16(in[i]);
+}
+
+void PackedVectorUtil::unpack(f32* out, const Snorm16* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = snorm16ToF32(in[i].value);
+}
+
+void PackedVectorUtil::pack(Unorm8* out, const f32* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i].value = f32ToUnorm8(in[i]);
+}
+
+void PackedVectorUtil::unpack(f32* out, const Unorm8* in, s32 n)
+{
+    for (s32 i = 0; i < n; ++i)
+        out[i] = unorm8ToF32(in[i].value);
+}
+
+}  // namespace sead
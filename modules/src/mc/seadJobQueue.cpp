@@ -118,7 +118,23 @@ void PerfJobQueue::initialize(const char* name, Heap* heap)
 {
     mBars.allocBufferAssert(CoreInfo::getNumCores(), heap);
     mInts.allocBufferAssert(CoreInfo::getNumCores(), heap);
+    initMeters_(name);
+}
 
+bool PerfJobQueue::tryInitialize(const char* name, Heap* heap)
+{
+    if (!mBars.tryAllocBuffer(CoreInfo::getNumCores(), heap) ||
+        !mInts.tryAllocBuffer(CoreInfo::getNumCores(), heap))
+    {
+        finalize();
+        return false;
+    }
+    initMeters_(name);
+    return true;
+}
+
+void PerfJobQueue::initMeters_(const char* name)
+{
     for (s32 i = 0; i < mInts.size(); ++i)
         mInts[CoreId(i)] = 0;
 
@@ -301,6 +317,27 @@ void FixedSizeJQ::initialize(u32 size, Heap* heap)
     mStatus = Status::_1;
 }
 
+bool FixedSizeJQ::tryInitialize(u32 size, Heap* heap)
+{
+#ifdef SEAD_DEBUG
+    if (!mPerf.tryInitialize(getName().cstr(), heap))
+        return false;
+#endif
+
+    ScopedLock<JobQueueLock> lock(&mLock);
+    if (!mJobs.tryAllocBuffer(size, heap))
+    {
+#ifdef SEAD_DEBUG
+        mPerf.finalize();
+#endif
+        return false;
+    }
+    mNumJobs = 0;
+    mNumProcessedJobs = 0;
+    mStatus = Status::_1;
+    return true;
+}
+
 void FixedSizeJQ::finalize()
 {
 #ifdef SEAD_DEBUG
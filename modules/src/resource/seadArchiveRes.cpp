@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <resource/seadArchiveRes.h>
 
 namespace sead
@@ -12,6 +14,39 @@ void ArchiveRes::doCreate_(u8* buf, u32, Heap*)
     mEnable = prepareArchive_(buf);
 }
 
+s32 ArchiveRes::getFiles(const void** files, FileInfo* file_infos, const SafeString* paths,
+                         s32 num) const
+{
+    SEAD_ASSERT(mEnable);
+
+    constexpr s32 cChunkSize = 64;
+    s32 entry_ids[cChunkSize];
+    s32 found = 0;
+
+    for (s32 base = 0; base < num; base += cChunkSize)
+    {
+        const s32 chunk = std::min(cChunkSize, num - base);
+        convertPathsToEntryIDsImpl_(paths + base, entry_ids, chunk);
+
+        for (s32 i = 0; i < chunk; ++i)
+        {
+            FileInfo* info = file_infos ? &file_infos[base + i] : nullptr;
+            files[base + i] = entry_ids[i] < 0 ? nullptr : getFileFastImpl_(entry_ids[i], info);
+            if (files[base + i])
+                ++found;
+        }
+    }
+
+    return found;
+}
+
+void ArchiveRes::convertPathsToEntryIDsImpl_(const SafeString* paths, s32* entry_ids,
+                                             s32 num) const
+{
+    for (s32 i = 0; i < num; ++i)
+        entry_ids[i] = convertPathToEntryIDImpl_(paths[i]);
+}
+
 bool ArchiveRes::isExistFileImpl_(const SafeString& path) const
 {
     return convertPathToEntryIDImpl_(path) != -1;
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <container/seadBuffer.h>
 #include <prim/seadPtrUtil.h>
 #include <prim/seadSafeString.h>
@@ -5,19 +7,6 @@
 
 namespace
 {
-u32 calcHash32(const sead::SafeString& str, u32 key)
-{
-    const char* str_ = str.cstr();
-
-    u32 result = 0;
-    // Each character must be treated as a signed value.
-    // The cast to s8 (not s32) is necessary to avoid unsigned conversions.
-    for (s32 i = 0; str_[i] != '\0'; i++)
-        result = result * key + s8(str_[i]);
-
-    return result;
-}
-
 #ifdef NNSDK
 s32 binarySearch_(u32 hash, const sead::SharcArchiveRes::FATEntry* buffer, s32 start, s32 end,
                   sead::Endian::Types endian)
@@ -57,6 +46,13 @@ s32 binarySearch_(u32 hash, const sead::SharcArchiveRes::FATEntry* buffer, s32 s
     }
 }
 
+inline u32 calcLookupSlot(u32 hash, u32 shift)
+{
+    // Fibonacci hashing: the archive hash is a plain multiplicative string hash whose low bits
+    // mostly depend on the last few characters, so spread it before taking the top bits.
+    return (hash * 0x9e3779b1u) >> shift;
+}
+
 }  // namespace
 
 namespace sead
@@ -66,6 +62,19 @@ struct SharcArchiveRes::HandleInner
     u32 x;
 };
 
+u32 SharcArchiveRes::calcHash32(const SafeString& str, u32 key)
+{
+    const char* str_ = str.cstr();
+
+    u32 result = 0;
+    // Each character must be treated as a signed value.
+    // The cast to s8 (not s32) is necessary to avoid unsigned conversions.
+    for (s32 i = 0; str_[i] != '\0'; i++)
+        result = result * key + s8(str_[i]);
+
+    return result;
+}
+
 SharcArchiveRes::SharcArchiveRes()
     : ArchiveRes(), mArchiveBlockHeader(NULL), mFATBlockHeader(NULL), mFNTBlock(NULL),
       mDataBlock(NULL)
@@ -76,10 +85,15 @@ SharcArchiveRes::SharcArchiveRes()
       ,
       mEndianType(Endian::cLittle)
 #endif
+      ,
+      mLookupSlotShift(0)
 {
 }
 
-SharcArchiveRes::~SharcArchiveRes() {}
+SharcArchiveRes::~SharcArchiveRes()
+{
+    freeLookupTable();
+}
 
 const void* SharcArchiveRes::getFileImpl_(const SafeString& file_path, FileInfo* file_info) const
 {
@@ -114,19 +128,87 @@ const void* SharcArchiveRes::getFileFastImpl_(s32 entry_id, FileInfo* file_info)
 
 s32 SharcArchiveRes::convertPathToEntryIDImpl_(const SafeString& file_path) const
 {
-    u32 hash = calcHash32(file_path, Endian::toHostU32(mEndianType, mFATBlockHeader->hash_key));
-
-    s32 start = 0;
-    s32 end = mFATEntrys.size();
+    u32 hash = calcPathHash_(file_path);
 
-#ifdef NNSDK
-    s32 id = binarySearch_(hash, mFATEntrys.getBufferPtr(), start, end, mEndianType);
-#else
-    s32 id = binarySearch_(hash, mFATEntrys.getBufferPtr(), start, end);
-#endif
+    s32 id = searchEntryIDByHash_(hash);
     if (id == -1)
         return -1;
 
+    return resolveHashCollision_(id, hash, file_path);
+}
+
+void SharcArchiveRes::convertPathsToEntryIDsImpl_(const SafeString* paths, s32* entry_ids,
+                                                  s32 num) const
+{
+    // With a lookup table, every lookup is already a single probe.
+    if (mLookupSlots.isBufferReady())
+    {
+        ArchiveRes::convertPathsToEntryIDsImpl_(paths, entry_ids, num);
+        return;
+    }
+
+    // Otherwise, sort the hashes of each chunk and walk the FAT once per chunk instead of
+    // running a full binary search for every path.
+    constexpr s32 cChunkSize = 128;
+    u32 hashes[cChunkSize];
+    u8 order[cChunkSize];
+
+    for (s32 base = 0; base < num; base += cChunkSize)
+    {
+        const s32 chunk = std::min(cChunkSize, num - base);
+        for (s32 i = 0; i < chunk; ++i)
+        {
+            hashes[i] = calcPathHash_(paths[base + i]);
+            order[i] = i;
+        }
+
+        std::sort(order, order + chunk, [&hashes](u8 a, u8 b) { return hashes[a] < hashes[b]; });
+
+        s32 id = 0;
+        for (s32 k = 0; k < chunk; ++k)
+        {
+            const s32 i = order[k];
+            id = lowerBoundEntryID_(hashes[i], id);
+            if (id >= mFATEntrys.size() || getEntryHash_(id) != hashes[i])
+                entry_ids[base + i] = -1;
+            else
+                entry_ids[base + i] = resolveHashCollision_(id, hashes[i], paths[base + i]);
+        }
+    }
+}
+
+s32 SharcArchiveRes::lowerBoundEntryID_(u32 hash, s32 start) const
+{
+    const s32 end = mFATEntrys.size();
+
+    // Gallop forward first: consecutive sorted hashes usually land close to each other.
+    s32 lo = start;
+    s32 hi = start;
+    for (s32 step = 1; hi < end && getEntryHash_(hi) < hash; step <<= 1)
+    {
+        lo = hi + 1;
+        hi += step;
+    }
+
+    if (hi > end)
+        hi = end;
+
+    while (lo < hi)
+    {
+        const s32 middle = (lo + hi) / 2;
+        if (getEntryHash_(middle) < hash)
+            lo = middle + 1;
+        else
+            hi = middle;
+    }
+
+    return lo;
+}
+
+s32 SharcArchiveRes::resolveHashCollision_(s32 id, u32 hash, const SafeString& file_path) const
+{
+    s32 end = mFATEntrys.size();
+
     u32 offset = Endian::toHostU32(mEndianType, mFATEntrys(id).name_offset);
     if (offset != 0)
     {
@@ -217,6 +299,8 @@ u32 SharcArchiveRes::readDirectoryImpl_(HandleBuffer* handle_, DirectoryEntry* e
 
 bool SharcArchiveRes::prepareArchive_(const void* archive)
 {
+    freeLookupTable();
+
     if (archive == nullptr)
     {
         SEAD_ASSERT_MSG(false, "archive must not be nullptr.");
@@ -314,13 +398,96 @@ SharcArchiveRes::HandleInner* SharcArchiveRes::getHandleInner_(HandleBuffer* han
 
 bool SharcArchiveRes::isExistFileImpl_(const SafeString& path) const
 {
-    const u32 hash = calcHash32(path, Endian::toHostU32(mEndianType, mFATBlockHeader->hash_key));
-    const u32 size = mFATEntrys.size();
+    return searchEntryIDByHash_(calcPathHash_(path)) != -1;
+}
+
+u32 SharcArchiveRes::calcPathHash_(const SafeString& path) const
+{
+    return calcHash32(path, Endian::toHostU32(mEndianType, mFATBlockHeader->hash_key));
+}
+
+s32 SharcArchiveRes::searchEntryIDByHash_(u32 hash) const
+{
+    if (mLookupSlots.isBufferReady())
+    {
+        const u32 mask = mLookupSlots.size() - 1;
+        for (u32 slot = calcLookupSlot(hash, mLookupSlotShift);; slot = (slot + 1) & mask)
+        {
+            const u32 value = mLookupSlots(slot);
+            if (value == 0)
+                return -1;
+
+            if (mHostHashes(value - 1) == hash)
+                return value - 1;
+        }
+    }
+
 #ifdef NNSDK
-    const s32 id = binarySearch_(hash, mFATEntrys.getBufferPtr(), 0, size, mEndianType);
+    return binarySearch_(hash, mFATEntrys.getBufferPtr(), 0, mFATEntrys.size(), mEndianType);
 #else
-    const s32 id = binarySearch_(hash, mFATEntrys.getBufferPtr(), 0, size);
+    return binarySearch_(hash, mFATEntrys.getBufferPtr(), 0, mFATEntrys.size());
 #endif
-    return id != -1;
+}
+
+bool SharcArchiveRes::createLookupTable(Heap* heap)
+{
+    freeLookupTable();
+
+    if (!mEnable)
+    {
+        SEAD_ASSERT_MSG(false, "archive is not prepared");
+        return false;
+    }
+
+    const s32 num = mFATEntrys.size();
+    if (num <= 0)
+        return false;
+
+    // Keep the load factor at or below 1/2 so that probe sequences stay within a cache line.
+    u32 shift = 32;
+    s32 capacity = 1;
+    while (capacity < num * 2)
+    {
+        capacity <<= 1;
+        --shift;
+    }
+
+    if (!mHostHashes.tryAllocBuffer(num, heap))
+        return false;
+
+    if (!mLookupSlots.tryAllocBuffer(capacity, heap))
+    {
+        mHostHashes.freeBuffer();
+        return false;
+    }
+
+    mLookupSlotShift = shift;
+    mLookupSlots.fill(0);
+
+    const u32 mask = capacity - 1;
+    for (s32 id = 0; id < num; ++id)
+    {
+        const u32 hash = Endian::toHostU32(mEndianType, mFATEntrys(id).hash);
+        mHostHashes(id) = hash;
+
+        // Entries are sorted by hash, so only the first entry of each collision run is indexed.
+        if (id != 0 && mHostHashes(id - 1) == hash)
+            continue;
+
+        u32 slot = calcLookupSlot(hash, shift);
+        while (mLookupSlots(slot) != 0)
+            slot = (slot + 1) & mask;
+
+        mLookupSlots(slot) = id + 1;
+    }
+
+    return true;
+}
+
+void SharcArchiveRes::freeLookupTable()
+{
+    mLookupSlots.freeBuffer();
+    mHostHashes.freeBuffer();
+    mLookupSlotShift = 0;
 }
 }  // namespace sead
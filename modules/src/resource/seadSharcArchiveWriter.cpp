@@ -0,0 +1,428 @@
+#include <algorithm>
+#include <cstring>
+
+#include <basis/seadRawPrint.h>
+#include <math/seadMathCalcCommon.h>
+#include <prim/seadPtrUtil.h>
+#include <resource/seadSharcArchiveWriter.h>
+#include <stream/seadStream.h>
+
+namespace
+{
+const u8 cZeroPadding[0x80] = {};
+
+class StreamSink
+{
+public:
+    explicit StreamSink(sead::WriteStream* stream) : mStream(stream) {}
+
+    void write(const void* data, u32 size)
+    {
+        mStream->writeMemBlock(data, size);
+        mPosition += size;
+    }
+
+    u32 getPosition() const { return mPosition; }
+
+private:
+    sead::WriteStream* mStream;
+    u32 mPosition = 0;
+};
+
+class MemorySink
+{
+public:
+    explicit MemorySink(void* buffer) : mBuffer(static_cast<u8*>(buffer)) {}
+
+    void write(const void* data, u32 size)
+    {
+        std::memcpy(mBuffer + mPosition, data, size);
+        mPosition += size;
+    }
+
+    u32 getPosition() const { return mPosition; }
+
+private:
+    u8* mBuffer;
+    u32 mPosition = 0;
+};
+
+template <typename Sink>
+void padTo(Sink* sink, u32 position)
+{
+    while (sink->getPosition() < position)
+        sink->write(cZeroPadding,
+                    std::min(u32(sizeof(cZeroPadding)), position - sink->getPosition()));
+}
+
+inline u32 lowestBit(u32 x)
+{
+    return x & (~x + 1);
+}
+
+}  // namespace
+
+namespace sead
+{
+SharcArchiveWriter::SharcArchiveWriter() = default;
+
+SharcArchiveWriter::~SharcArchiveWriter()
+{
+    freeBuffer();
+}
+
+void SharcArchiveWriter::allocBuffer(s32 max_files, Heap* heap)
+{
+    SEAD_ASSERT(!isBufferReady());
+    mEntries.allocBuffer(max_files, heap);
+    mOrder.allocBuffer(max_files, heap);
+    mNumEntries = 0;
+}
+
+bool SharcArchiveWriter::tryAllocBuffer(s32 max_files, Heap* heap)
+{
+    SEAD_ASSERT(!isBufferReady());
+    if (!mEntries.tryAllocBuffer(max_files, heap))
+        return false;
+
+    if (!mOrder.tryAllocBuffer(max_files, heap))
+    {
+        mEntries.freeBuffer();
+        return false;
+    }
+
+    mNumEntries = 0;
+    return true;
+}
+
+void SharcArchiveWriter::freeBuffer()
+{
+    mEntries.freeBuffer();
+    mOrder.freeBuffer();
+    mNumEntries = 0;
+}
+
+void SharcArchiveWriter::setDefaultAlignment(u32 alignment)
+{
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    {
+        SEAD_ASSERT_MSG(false, "alignment[%u] must be a power of two", alignment);
+        return;
+    }
+
+    mDefaultAlignment = alignment;
+}
+
+bool SharcArchiveWriter::addFile(const SafeString& path, const void* data, u32 size,
+                                 u32 alignment)
+{
+    if (path.isEmpty())
+    {
+        SEAD_ASSERT_MSG(false, "path must not be empty");
+        return false;
+    }
+
+    return addEntry_(path.cstr(), SharcArchiveRes::calcHash32(path, mHashKey), data, size,
+                     alignment != 0 ? alignment : mDefaultAlignment);
+}
+
+s32 SharcArchiveWriter::addArchive(const SharcArchiveRes& archive)
+{
+    if (!archive.mEnable)
+    {
+        SEAD_ASSERT_MSG(false, "archive is not prepared");
+        return 0;
+    }
+
+    const Endian::Types endian = archive.mEndianType;
+    const u32 hash_key = Endian::toHostU32(endian, archive.mFATBlockHeader->hash_key);
+    const u32 data_block_offset =
+        Endian::toHostU32(endian, archive.mArchiveBlockHeader->data_block_offset);
+
+    s32 count = 0;
+    for (s32 i = 0; i < archive.mFATEntrys.size(); ++i)
+    {
+        const SharcArchiveRes::FATEntry& fat_entry = archive.mFATEntrys(i);
+        const u32 start = Endian::toHostU32(endian, fat_entry.data_start_offset);
+        const u32 end = Endian::toHostU32(endian, fat_entry.data_end_offset);
+        if (start > end)
+        {
+            SEAD_WARN("Invalid data offset (entry %d)", i);
+            continue;
+        }
+
+        const u32 name_offset = Endian::toHostU32(endian, fat_entry.name_offset);
+        const char* name =
+            name_offset != 0 ?
+                archive.mFNTBlock +
+                    (name_offset & 0xffffff) * SharcArchiveRes::cFileNameTableAlign :
+                nullptr;
+
+        u32 hash = Endian::toHostU32(endian, fat_entry.hash);
+        if (hash_key != mHashKey)
+        {
+            if (!name)
+            {
+                SEAD_WARN("entry %d has no name and cannot be rehashed (key %x -> %x)", i,
+                          hash_key, mHashKey);
+                continue;
+            }
+            hash = SharcArchiveRes::calcHash32(name, mHashKey);
+        }
+
+        // The data is only guaranteed to be as aligned as its offset from the archive start.
+        u32 alignment = lowestBit(data_block_offset | start);
+        if (alignment == 0)
+            alignment = mDefaultAlignment;
+
+        if (!addEntry_(name, hash, archive.mDataBlock + start, end - start, alignment))
+            break;
+
+        ++count;
+    }
+
+    return count;
+}
+
+bool SharcArchiveWriter::addEntry_(const char* name, u32 hash, const void* data, u32 size,
+                                   u32 alignment)
+{
+    if (mNumEntries >= mEntries.size())
+    {
+        SEAD_ASSERT_MSG(false, "buffer full [%d]", mEntries.size());
+        return false;
+    }
+
+    if ((alignment & (alignment - 1)) != 0)
+    {
+        SEAD_ASSERT_MSG(false, "alignment[%u] must be a power of two", alignment);
+        return false;
+    }
+
+    if (data == nullptr && size != 0)
+    {
+        SEAD_ASSERT_MSG(false, "data must not be null");
+        return false;
+    }
+
+    Entry& entry = mEntries(mNumEntries++);
+    entry.name = name;
+    entry.name_length = name ? std::strlen(name) : 0;
+    entry.hash = hash;
+    entry.data = data;
+    entry.size = size;
+    entry.alignment = alignment;
+    entry.data_offset = 0;
+    entry.name_offset = 0;
+    return true;
+}
+
+bool SharcArchiveWriter::calcLayout_(Layout* layout)
+{
+    const auto is_same_file = [this](s32 a, s32 b) {
+        const Entry& lhs = mEntries(a);
+        const Entry& rhs = mEntries(b);
+        if (lhs.name == nullptr || rhs.name == nullptr)
+            return lhs.name == rhs.name;
+        return lhs.name_length == rhs.name_length && std::strcmp(lhs.name, rhs.name) == 0;
+    };
+
+    for (s32 i = 0; i < mNumEntries; ++i)
+        mOrder(i) = i;
+
+    // Sort by hash. Entries that were added later come later within a collision run.
+    s32* order = mOrder.getBufferPtr();
+    std::sort(order, order + mNumEntries, [this](s32 a, s32 b) {
+        const u32 hash_a = mEntries(a).hash;
+        const u32 hash_b = mEntries(b).hash;
+        return hash_a != hash_b ? hash_a < hash_b : a < b;
+    });
+
+    // Drop entries that are overridden by a later entry with the same path.
+    s32 num = 0;
+    for (s32 run_start = 0; run_start < mNumEntries;)
+    {
+        s32 run_end = run_start + 1;
+        const u32 hash = mEntries(order[run_start]).hash;
+        while (run_end < mNumEntries && mEntries(order[run_end]).hash == hash)
+            ++run_end;
+
+        for (s32 i = run_start; i < run_end; ++i)
+        {
+            bool overridden = false;
+            for (s32 j = i + 1; j < run_end && !overridden; ++j)
+                overridden = is_same_file(order[i], order[j]);
+
+            if (!overridden)
+                order[num++] = order[i];
+        }
+
+        run_start = run_end;
+    }
+
+    if (u32(num) > SharcArchiveRes::cArchiveEntryMax)
+    {
+        SEAD_ASSERT_MSG(false, "too many files [%d/%u]", num, SharcArchiveRes::cArchiveEntryMax);
+        return false;
+    }
+
+    // File name table. The top byte of the name offset is the 1-based index of the entry
+    // within its collision run.
+    u32 fnt_size = 0;
+    u32 run_index = 0;
+    for (s32 i = 0; i < num; ++i)
+    {
+        Entry& entry = mEntries(order[i]);
+        if (i != 0 && mEntries(order[i - 1]).hash == entry.hash)
+            ++run_index;
+        else
+            run_index = 1;
+
+        if (entry.name == nullptr)
+        {
+            entry.name_offset = 0;
+            continue;
+        }
+
+        if (run_index > 0xff || fnt_size / SharcArchiveRes::cFileNameTableAlign > 0xffffff)
+        {
+            SEAD_ASSERT_MSG(false, "file name table overflow");
+            return false;
+        }
+
+        entry.name_offset = run_index << 24 | fnt_size / SharcArchiveRes::cFileNameTableAlign;
+        fnt_size += Mathu::roundUpPow2(entry.name_length + 1, SharcArchiveRes::cFileNameTableAlign);
+    }
+
+    // Data block. Its start must be aligned to the largest file alignment so that the files
+    // are aligned in memory when the archive itself is loaded with that alignment.
+    u32 max_alignment = 1;
+    u32 data_size = 0;
+    for (s32 i = 0; i < num; ++i)
+    {
+        Entry& entry = mEntries(order[i]);
+        max_alignment = std::max(max_alignment, entry.alignment);
+        entry.data_offset = Mathu::roundUpPow2(data_size, entry.alignment);
+        data_size = entry.data_offset + entry.size;
+    }
+
+    const u32 fnt_end = sizeof(SharcArchiveRes::ArchiveBlockHeader) +
+                        sizeof(SharcArchiveRes::FATBlockHeader) +
+                        num * sizeof(SharcArchiveRes::FATEntry) +
+                        sizeof(SharcArchiveRes::FNTBlockHeader) + fnt_size;
+
+    layout->num_files = num;
+    layout->fnt_size = fnt_size;
+    layout->data_block_offset = Mathu::roundUpPow2(fnt_end, max_alignment);
+    layout->file_size = layout->data_block_offset + data_size;
+    return true;
+}
+
+u32 SharcArchiveWriter::calcArchiveSize()
+{
+    Layout layout;
+    if (!calcLayout_(&layout))
+        return 0;
+
+    return layout.file_size;
+}
+
+u32 SharcArchiveWriter::write(WriteStream* stream)
+{
+    Layout layout;
+    if (!calcLayout_(&layout))
+        return 0;
+
+    StreamSink sink(stream);
+    return write_(&sink, layout);
+}
+
+u32 SharcArchiveWriter::write(void* buffer, u32 buffer_size)
+{
+    Layout layout;
+    if (!calcLayout_(&layout))
+        return 0;
+
+    if (layout.file_size > buffer_size)
+    {
+        SEAD_ASSERT_MSG(false, "buffer too small [%u/%u]", buffer_size, layout.file_size);
+        return 0;
+    }
+
+    MemorySink sink(buffer);
+    return write_(&sink, layout);
+}
+
+template <typename Sink>
+u32 SharcArchiveWriter::write_(Sink* sink, const Layout& layout) const
+{
+    SharcArchiveRes::ArchiveBlockHeader archive_header;
+    std::memcpy(archive_header.signature, "SARC", 4);
+    archive_header.header_size =
+        Endian::fromHostU16(mEndian, sizeof(SharcArchiveRes::ArchiveBlockHeader));
+    archive_header.byte_order = Endian::fromHostU16(mEndian, 0xfeff);
+    archive_header.file_size = Endian::fromHostU32(mEndian, layout.file_size);
+    archive_header.data_block_offset = Endian::fromHostU32(mEndian, layout.data_block_offset);
+    archive_header.version = Endian::fromHostU16(mEndian, SharcArchiveRes::cArchiveVersion);
+    archive_header.reserved = 0;
+    sink->write(&archive_header, sizeof(archive_header));
+
+    SharcArchiveRes::FATBlockHeader fat_header;
+    std::memcpy(fat_header.signature, "SFAT", 4);
+    fat_header.header_size = Endian::fromHostU16(mEndian, sizeof(SharcArchiveRes::FATBlockHeader));
+    fat_header.file_num = Endian::fromHostU16(mEndian, layout.num_files);
+    fat_header.hash_key = Endian::fromHostU32(mEndian, mHashKey);
+    sink->write(&fat_header, sizeof(fat_header));
+
+    // Batch FAT entries to avoid issuing one small write per entry.
+    constexpr s32 cFATChunkSize = 32;
+    SharcArchiveRes::FATEntry fat_entries[cFATChunkSize];
+    const s32 num = layout.num_files;
+    for (s32 base = 0; base < num; base += cFATChunkSize)
+    {
+        const s32 chunk = std::min(cFATChunkSize, num - base);
+        for (s32 i = 0; i < chunk; ++i)
+        {
+            const Entry& entry = mEntries(mOrder(base + i));
+            fat_entries[i].hash = Endian::fromHostU32(mEndian, entry.hash);
+            fat_entries[i].name_offset = Endian::fromHostU32(mEndian, entry.name_offset);
+            fat_entries[i].data_start_offset = Endian::fromHostU32(mEndian, entry.data_offset);
+            fat_entries[i].data_end_offset =
+                Endian::fromHostU32(mEndian, entry.data_offset + entry.size);
+        }
+        sink->write(fat_entries, chunk * sizeof(SharcArchiveRes::FATEntry));
+    }
+
+    SharcArchiveRes::FNTBlockHeader fnt_header;
+    std::memcpy(fnt_header.signature, "SFNT", 4);
+    fnt_header.header_size = Endian::fromHostU16(mEndian, sizeof(SharcArchiveRes::FNTBlockHeader));
+    fnt_header.reserved = 0;
+    sink->write(&fnt_header, sizeof(fnt_header));
+
+    const u32 fnt_start = sink->getPosition();
+    for (s32 i = 0; i < num; ++i)
+    {
+        const Entry& entry = mEntries(mOrder(i));
+        if (entry.name == nullptr)
+            continue;
+
+        sink->write(entry.name, entry.name_length);
+        padTo(sink, Mathu::roundUpPow2(sink->getPosition() + 1,
+                                       SharcArchiveRes::cFileNameTableAlign));
+    }
+    SEAD_ASSERT(sink->getPosition() == fnt_start + layout.fnt_size);
+
+    padTo(sink, layout.data_block_offset);
+    for (s32 i = 0; i < num; ++i)
+    {
+        const Entry& entry = mEntries(mOrder(i));
+        padTo(sink, layout.data_block_offset + entry.data_offset);
+        if (entry.size != 0)
+            sink->write(entry.data, entry.size);
+    }
+
+    SEAD_ASSERT(sink->getPosition() == layout.file_size);
+    return sink->getPosition();
+}
+
+}  // namespace sead